@@ -0,0 +1,2054 @@
+1
+9
+252
+0
+22
+92
+0
+84
+27
+0
+0
+75
+0
+49
+96
+0
+26
+0
+98
+2
+0
+0
+86
+0
+0
+0
+130
+5
+130
+0
+0
+1
+11
+0
+60
+2
+96
+9
+48
+7
+31
+31
+93
+0
+104
+0
+64
+0
+21
+0
+75
+1
+0
+25
+156
+38
+0
+25
+0
+0
+92
+0
+38
+0
+84
+13
+0
+12
+0
+0
+0
+8
+28
+48
+106
+63
+24
+0
+66
+18
+62
+27
+41
+39
+55
+193
+5
+78
+0
+65
+152
+99
+0
+0
+59
+16
+0
+6
+0
+1
+110
+0
+0
+0
+104
+0
+121
+20
+91
+156
+30
+0
+0
+46
+0
+0
+0
+1
+93
+31
+0
+0
+65
+1
+79
+0
+82
+0
+62
+91
+0
+0
+0
+56
+94
+0
+4
+37
+105
+0
+0
+0
+0
+69
+82
+207
+0
+0
+2
+7
+14
+25
+13
+115
+0
+77
+0
+7
+33
+0
+0
+87
+0
+0
+0
+0
+0
+0
+97
+18
+10
+0
+58
+0
+179
+0
+0
+0
+32
+46
+0
+29
+32
+68
+85
+19
+33
+1
+0
+87
+52
+70
+72
+0
+71
+46
+0
+150
+125
+0
+75
+0
+1
+60
+0
+26
+0
+18
+83
+0
+0
+0
+109
+0
+37
+0
+24
+0
+105
+2
+60
+1
+61
+0
+159
+0
+20
+17
+0
+23
+34
+35
+0
+0
+0
+47
+5
+0
+1
+175
+0
+54
+0
+96
+34
+85
+157
+0
+0
+94
+0
+0
+1
+122
+41
+0
+0
+115
+0
+0
+5
+121
+215
+0
+0
+61
+58
+15
+0
+53
+0
+0
+81
+26
+55
+0
+18
+7
+0
+3
+163
+29
+18
+90
+140
+61
+20
+12
+72
+0
+0
+34
+68
+1
+79
+0
+0
+0
+83
+113
+0
+0
+14
+0
+31
+23
+0
+56
+52
+0
+57
+48
+1
+50
+0
+15
+21
+0
+134
+39
+72
+0
+83
+106
+31
+0
+0
+0
+0
+74
+70
+74
+0
+0
+0
+93
+25
+25
+73
+0
+38
+37
+5
+0
+38
+9
+0
+63
+0
+0
+0
+81
+0
+0
+0
+19
+42
+4
+63
+34
+21
+0
+0
+0
+106
+0
+0
+138
+0
+128
+25
+0
+96
+0
+43
+37
+0
+0
+98
+0
+0
+72
+0
+0
+0
+0
+0
+0
+0
+0
+0
+15
+44
+12
+0
+92
+0
+21
+0
+33
+20
+0
+2
+40
+77
+0
+34
+123
+0
+0
+0
+0
+47
+8
+2
+81
+84
+0
+62
+60
+23
+0
+42
+0
+47
+58
+0
+0
+70
+103
+57
+84
+45
+0
+0
+102
+30
+0
+127
+8
+85
+0
+68
+1
+0
+84
+0
+0
+25
+0
+0
+0
+0
+13
+0
+20
+0
+0
+0
+87
+13
+4
+6
+134
+96
+44
+0
+0
+0
+26
+48
+0
+55
+0
+0
+49
+0
+21
+56
+1
+0
+41
+0
+0
+85
+11
+83
+6
+0
+3
+0
+17
+0
+192
+1
+0
+0
+113
+0
+40
+137
+0
+21
+2
+62
+15
+6
+25
+25
+68
+124
+0
+0
+22
+0
+74
+18
+71
+17
+0
+137
+7
+55
+119
+13
+140
+0
+37
+0
+0
+0
+1
+28
+3
+0
+0
+0
+1
+27
+0
+0
+7
+2
+5
+46
+57
+0
+25
+12
+43
+0
+0
+5
+0
+28
+60
+103
+78
+0
+41
+20
+43
+0
+0
+9
+54
+0
+37
+0
+0
+0
+74
+15
+47
+1
+35
+111
+63
+6
+0
+0
+1
+55
+176
+45
+2
+144
+0
+0
+125
+0
+0
+0
+0
+47
+45
+0
+26
+5
+0
+3
+47
+1
+0
+75
+0
+0
+0
+19
+54
+61
+77
+0
+3
+19
+19
+10
+105
+0
+23
+0
+2
+35
+0
+85
+215
+1
+67
+0
+110
+55
+1
+15
+15
+28
+61
+0
+0
+52
+2
+0
+66
+27
+0
+100
+8
+209
+0
+0
+51
+77
+60
+2
+165
+0
+159
+0
+28
+37
+34
+8
+51
+36
+64
+1
+10
+14
+3
+0
+58
+0
+0
+0
+76
+121
+0
+43
+7
+74
+0
+0
+11
+118
+0
+0
+19
+0
+14
+9
+0
+0
+0
+0
+0
+0
+38
+45
+0
+0
+58
+177
+0
+79
+0
+17
+46
+7
+52
+27
+0
+102
+4
+1
+97
+19
+58
+0
+45
+0
+37
+75
+0
+20
+5
+0
+30
+7
+1
+31
+1
+0
+25
+88
+0
+131
+73
+0
+55
+8
+62
+28
+0
+81
+0
+82
+69
+11
+0
+0
+57
+137
+22
+17
+0
+51
+7
+1
+0
+0
+81
+0
+0
+43
+23
+0
+0
+0
+18
+34
+0
+42
+100
+0
+10
+23
+0
+148
+126
+0
+0
+39
+52
+25
+6
+19
+0
+0
+44
+0
+14
+60
+53
+51
+112
+23
+100
+53
+0
+0
+0
+28
+49
+76
+98
+64
+0
+0
+5
+0
+0
+119
+1
+0
+0
+0
+0
+0
+0
+140
+54
+145
+59
+0
+94
+9
+97
+19
+21
+0
+0
+143
+15
+45
+0
+36
+0
+0
+29
+0
+5
+126
+23
+0
+0
+122
+0
+17
+0
+182
+0
+17
+0
+45
+32
+0
+0
+0
+14
+0
+0
+1
+0
+0
+0
+4
+0
+98
+71
+0
+48
+0
+0
+0
+0
+0
+47
+17
+0
+21
+37
+190
+1
+22
+39
+0
+11
+1
+0
+11
+17
+0
+0
+1
+90
+0
+56
+0
+47
+99
+0
+0
+39
+173
+59
+18
+37
+0
+40
+0
+40
+0
+0
+4
+0
+0
+152
+0
+41
+105
+151
+0
+18
+5
+82
+44
+0
+46
+0
+57
+8
+28
+0
+0
+80
+0
+0
+213
+0
+0
+0
+0
+0
+38
+26
+72
+0
+4
+0
+9
+0
+0
+105
+0
+21
+102
+68
+15
+7
+0
+88
+42
+64
+0
+0
+170
+1
+0
+6
+0
+0
+0
+10
+9
+0
+40
+33
+24
+0
+0
+23
+13
+20
+0
+0
+0
+0
+24
+0
+187
+0
+104
+0
+0
+0
+9
+32
+0
+131
+0
+55
+20
+0
+24
+22
+107
+17
+28
+117
+0
+0
+81
+0
+1
+120
+95
+139
+2
+9
+207
+0
+0
+36
+5
+0
+60
+0
+80
+15
+0
+47
+0
+85
+16
+0
+0
+50
+0
+91
+42
+0
+9
+164
+23
+14
+58
+46
+0
+18
+0
+19
+0
+14
+0
+1
+0
+45
+0
+39
+5
+0
+80
+45
+33
+4
+0
+12
+17
+38
+17
+94
+108
+99
+0
+51
+1
+0
+0
+0
+23
+27
+146
+222
+137
+0
+72
+37
+94
+0
+0
+87
+3
+45
+80
+13
+5
+52
+63
+1
+88
+0
+15
+1
+25
+26
+61
+75
+40
+1
+71
+89
+77
+0
+29
+0
+99
+0
+0
+0
+1
+116
+5
+0
+0
+16
+0
+0
+22
+84
+0
+0
+76
+2
+77
+22
+9
+0
+0
+0
+0
+0
+68
+129
+0
+0
+0
+8
+1
+0
+17
+41
+0
+55
+0
+0
+52
+50
+18
+128
+107
+7
+36
+0
+0
+30
+36
+0
+1
+0
+23
+31
+44
+73
+0
+29
+21
+109
+61
+0
+96
+1
+5
+0
+96
+17
+39
+126
+51
+12
+0
+0
+21
+0
+0
+0
+0
+121
+7
+80
+55
+0
+57
+91
+9
+0
+0
+17
+0
+24
+100
+0
+62
+86
+19
+25
+0
+0
+28
+159
+0
+0
+19
+0
+2
+0
+62
+62
+1
+0
+8
+1
+0
+0
+0
+15
+0
+0
+0
+22
+24
+55
+84
+72
+0
+0
+0
+0
+15
+0
+102
+13
+46
+12
+19
+13
+62
+25
+3
+0
+92
+0
+0
+0
+17
+50
+0
+16
+31
+55
+55
+0
+27
+56
+43
+0
+50
+0
+46
+151
+0
+0
+0
+37
+0
+64
+11
+13
+14
+159
+0
+116
+17
+18
+0
+40
+0
+2
+0
+23
+0
+0
+83
+0
+0
+80
+95
+15
+48
+0
+47
+82
+0
+0
+0
+1
+4
+65
+23
+0
+0
+94
+25
+3
+0
+0
+0
+20
+127
+39
+1
+0
+17
+0
+20
+0
+63
+0
+49
+66
+0
+0
+0
+0
+31
+2
+0
+0
+53
+68
+0
+0
+1
+33
+0
+0
+110
+0
+0
+0
+0
+1
+5
+87
+13
+10
+105
+64
+0
+0
+1
+0
+168
+77
+0
+1
+0
+17
+92
+41
+0
+87
+62
+0
+0
+0
+0
+5
+111
+0
+116
+63
+0
+0
+0
+0
+0
+12
+0
+52
+0
+1
+0
+0
+33
+0
+0
+119
+28
+0
+181
+50
+0
+12
+97
+29
+49
+39
+34
+55
+42
+20
+0
+92
+12
+0
+5
+0
+43
+4
+55
+60
+31
+0
+0
+0
+0
+8
+140
+21
+0
+0
+103
+94
+11
+0
+2
+79
+0
+44
+21
+0
+118
+92
+7
+20
+0
+63
+20
+0
+160
+70
+75
+0
+0
+0
+0
+74
+0
+32
+72
+0
+58
+138
+75
+0
+0
+61
+37
+122
+4
+1
+0
+32
+21
+5
+0
+22
+119
+0
+91
+93
+0
+106
+1
+0
+0
+26
+0
+45
+48
+0
+31
+0
+81
+50
+0
+18
+0
+0
+50
+0
+72
+24
+40
+29
+76
+84
+0
+12
+5
+0
+0
+13
+36
+0
+71
+38
+0
+112
+33
+1
+72
+0
+7
+0
+0
+0
+70
+0
+1
+54
+0
+38
+8
+105
+45
+30
+60
+84
+1
+93
+33
+58
+25
+0
+0
+0
+0
+1
+53
+73
+0
+105
+9
+33
+43
+68
+0
+36
+81
+61
+0
+0
+12
+61
+0
+95
+0
+0
+29
+64
+0
+35
+68
+0
+0
+0
+168
+0
+0
+0
+0
+0
+8
+0
+109
+0
+7
+42
+50
+0
+0
+0
+33
+84
+87
+42
+0
+1
+142
+14
+0
+0
+61
+0
+0
+134
+0
+193
+8
+259
+67
+62
+39
+103
+198
+0
+0
+0
+0
+0
+73
+52
+0
+56
+78
+41
+0
+0
+0
+113
+47
+8
+1
+47
+15
+28
+22
+0
+8
+91
+0
+74
+0
+40
+50
+86
+9
+0
+0
+8
+0
+0
+48
+0
+24
+0
+115
+59
+0
+0
+0
+0
+0
+20
+0
+94
+83
+0
+121
+47
+0
+1
+82
+55
+1
+0
+35
+0
+1
+56
+15
+0
+13
+58
+5
+15
+17
+97
+57
+0
+26
+73
+0
+10
+0
+0
+77
+41
+57
+0
+9
+0
+37
+112
+0
+105
+19
+113
+0
+16
+1
+4
+0
+22
+44
+0
+0
+13
+93
+0
+0
+1
+0
+158
+0
+0
+83
+0
+55
+0
+0
+0
+0
+26
+0
+0
+22
+0
+0
+0
+0
+56
+5
+41
+158
+0
+0
+0
+78
+41
+0
+0
+8
+0
+147
+0
+112
+0
+11
+0
+4
+0
+113
+0
+0
+0
+0
+0
+38
+12
+14
+0
+26
+100
+39
+0
+0
+75
+0
+9
+0
+0
+44
+79
+3
+16
+52
+35
+0
+0
+75
+1
+0
+27
+0
+0
+81
+6
+7
+55
+0
+0
+98
+0
+69
+0
+1
+8
+0
+0
+0
+89
+0
+88
+0
+0
+7
+0
+42
+0
+63
+0
+0
+24
+0
+14
+0
+5
+0
+82
+16
+36
+0
+146
+1
+12
+163
+63
+41
+11
+2
+136
+0
+74
+54
+31
+0
+12
+3
+1
+0
+0
+171
+15
+0
+20
+13
+46
+0
+0
+0
+0
+0
+97
+10
+51
+0
+0
+37
+0
+0
+6
+20
+66
+54
+37
+37
+71
+0
+0
+2
+124
+69
+16
+48
+41
+51
+27
+60
+55
+62
+57
+0
+0
+15
+0
+0
+47
+0
+62
+0
+13
+0
+0
+27
+0
+32
+128
+0
+0
+21
+0
+30
+178
+44
+15
+0
+28
+45
+31
+0
+123
+8
+102
+75
+36
+0
+45
+0
+40
+1
+15
+18
+15
+27
+0
+21
+3
+0
+34
+0
+0
+0
+93
+0
+26
+71
+0
+92
+0
+0
+1
+12
+118
+0
+45
+0
+1
+0
+0
+40
+53
+15
+10
+0
+0
+80
+0
+92
+0
+132
+46
+22
+0
+84
+75
+17
+0
+46
+35
+0
+0
+0
+10
+17
+0
+0
+0
+27
+0
+47
+
+
+Variables
+=
+481
+Clauses
+=
+2000
+TotalLiterals
+=
+6000
+TotalCPUTimeElapsed
+=
+0.003
+
+
+
+
+
+FlipsPerSecond
+=
+1102536
+RunsExecuted
+=
+1
+SuccessfulRuns
+=
+0
+PercentSuccess
+=
+0.00
+
+
+Steps_Mean
+=
+3000
+Steps_CoeffVariance
+=
+0
+Steps_Median
+=
+3000
+CPUTime_Mean
+=
+0.002721
+CPUTime_CoeffVariance
+=
+0
+CPUTime_Median
+=
+0.002721
+
+
@@ -0,0 +1,294 @@
+#!/bin/sh
+#
+# UBCSAT benchmark suite (make bench)
+#
+# bench.sh run
+#   generates the benchmark instances (if they don't already exist) and
+#   runs every algorithm listed by (ubcsat -ha) and (ubcsat -hw) for
+#   BENCH_RUNS runs of BENCH_FLIPS steps on each instance of each size in
+#   BENCH_SIZES (all with the same seed, so the flips are reproducible).
+#   unweighted algorithms use the ksat & struct instances, weighted
+#   algorithms use the weighted instances
+#
+#   the results are written to BENCH_OUT as csv:
+#     instance,algorithm,flips,fps,readtime,peakrss,totaltime
+#   (flips is the mean over the runs, and can be less than BENCH_FLIPS
+#    if a solution was found or BENCH_TIMEOUT was reached,
+#    readtime is the CPU time spent parsing the instance, peakrss is in KB)
+#
+#   if BENCH_BASELINE is set, BENCH_OUT is then compared against it
+#
+# bench.sh parflip
+#   finds the crossover point of the parallel flips (-parflip): hub
+#   instances of PARFLIP_CLAUSES clauses are generated with each number of
+#   hub variables in PARFLIP_HUBS (so each hub variable occurs in about
+#   PARFLIP_CLAUSES / (2 * hubs) clauses), and each algorithm in
+#   PARFLIP_ALGS is run serially and then with -threads T -parflip D
+#   (D is half the hub degree, so only the hub variables are flipped in
+#   parallel) for each T in PARFLIP_THREADS
+#
+#   the results are written to PARFLIP_OUT as csv:
+#     hubdegree,algorithm,threads,serialfps,parallelfps,speedup
+#   followed by the crossover (the smallest hub degree with a speedup)
+#   for each algorithm & number of threads
+#
+# bench.sh check
+#   runs every weighted algorithm (ubcsat -hw) on sample.wcnf, which has
+#   zero weight clauses, and every algorithm (ubcsat -ha) on sample.cnf,
+#   and checks that the mean branching factor (branchfact_w, branchfact)
+#   is a fraction of the variables, as a check of the maintained counts
+#   of zero score variables.  The exit status is 1 if any check fails
+#
+# bench.sh diff OLD NEW
+#   compares two baselines, printing the change in flips per second and
+#   peak memory for each (instance,algorithm) pair.  A drop in flips per
+#   second larger than BENCH_THRESHOLD percent is reported as a regression
+#   and the exit status is 1
+#
+# variables (with the defaults used by the Makefile):
+#   UBCSAT           ./ubcsat
+#   GENCNF           bench/gencnf
+#   BENCH_SIZES      "1000 10000 100000 1000000"  (number of clauses)
+#   BENCH_FLIPS      1000000
+#   BENCH_RUNS       3
+#   BENCH_SEED       1
+#   BENCH_TIMEOUT    10  (seconds of CPU time per algorithm & instance)
+#   BENCH_DIR        bench/instances
+#   BENCH_OUT        bench/baseline.csv
+#   BENCH_BASELINE   (none)
+#   BENCH_THRESHOLD  10
+#   PARFLIP_CLAUSES  1000000
+#   PARFLIP_HUBS     "1000 300 100 30 10"
+#   PARFLIP_THREADS  "2 4 8"
+#   PARFLIP_ALGS     "walksat saps"
+#   PARFLIP_OUT      bench/parflip.csv
+
+UBCSAT=${UBCSAT:-./ubcsat}
+GENCNF=${GENCNF:-bench/gencnf}
+BENCH_SIZES=${BENCH_SIZES:-"1000 10000 100000 1000000"}
+BENCH_FLIPS=${BENCH_FLIPS:-1000000}
+BENCH_RUNS=${BENCH_RUNS:-3}
+BENCH_SEED=${BENCH_SEED:-1}
+BENCH_TIMEOUT=${BENCH_TIMEOUT:-10}
+BENCH_DIR=${BENCH_DIR:-bench/instances}
+BENCH_OUT=${BENCH_OUT:-bench/baseline.csv}
+BENCH_THRESHOLD=${BENCH_THRESHOLD:-10}
+PARFLIP_CLAUSES=${PARFLIP_CLAUSES:-1000000}
+PARFLIP_HUBS=${PARFLIP_HUBS:-"1000 300 100 30 10"}
+PARFLIP_THREADS=${PARFLIP_THREADS:-"2 4 8"}
+PARFLIP_ALGS=${PARFLIP_ALGS:-"walksat saps"}
+PARFLIP_OUT=${PARFLIP_OUT:-bench/parflip.csv}
+
+usage() {
+  echo "usage: bench.sh run | bench.sh parflip | bench.sh check | bench.sh diff OLD.csv NEW.csv" >&2
+  exit 2
+}
+
+generate() {
+  # generate TYPE CLAUSES FILE
+  if [ ! -f "$3" ]; then
+    echo "bench: generating $3" >&2
+    "$GENCNF" -type "$1" -clauses "$2" -seed "$BENCH_SEED" -o "$3" || exit 1
+  fi
+}
+
+runone() {
+  # runone INSTANCE ALGORITHM...
+  INST=$1
+  shift
+  "$UBCSAT" -alg "$@" -i "$INST" -runs "$BENCH_RUNS" -cutoff "$BENCH_FLIPS" -seed "$BENCH_SEED" \
+    -gtimeout "$BENCH_TIMEOUT" -r out null -rformat csv \
+    -r stats stdout steps[mean],fps,readtime,peakrss,totaltime 2>/dev/null |
+  awk -F, -v inst="`basename $INST`" -v alg="$*" '
+    $1 == "Steps_Mean"          { flips = $2 }
+    $1 == "FlipsPerSecond"      { fps = $2 }
+    $1 == "ReadCPUTime"         { readtime = $2 }
+    $1 == "PeakResidentKB"      { peakrss = $2 }
+    $1 == "TotalCPUTimeElapsed" { totaltime = $2 }
+    END { printf "%s,%s,%s,%s,%s,%s,%s\n", inst, alg, flips, fps, readtime, peakrss, totaltime }'
+}
+
+runall() {
+  mkdir -p "$BENCH_DIR" || exit 1
+
+  for N in $BENCH_SIZES; do
+    generate ksat "$N" "$BENCH_DIR/ksat-$N.cnf"
+    generate struct "$N" "$BENCH_DIR/struct-$N.cnf"
+    generate weighted "$N" "$BENCH_DIR/weighted-$N.wcnf"
+  done
+
+  ALGS=`"$UBCSAT" -ha | sed -n 's/^-alg //p'`
+  WALGS=`"$UBCSAT" -hw | sed -n 's/^-alg //p'`
+
+  echo "instance,algorithm,flips,fps,readtime,peakrss,totaltime" > "$BENCH_OUT.tmp"
+
+  for N in $BENCH_SIZES; do
+    echo "$ALGS" | while read ALG; do
+      for T in ksat struct; do
+        echo "bench: $T-$N $ALG" >&2
+        runone "$BENCH_DIR/$T-$N.cnf" $ALG >> "$BENCH_OUT.tmp"
+      done
+    done
+    echo "$WALGS" | while read ALG; do
+      echo "bench: weighted-$N $ALG" >&2
+      runone "$BENCH_DIR/weighted-$N.wcnf" $ALG >> "$BENCH_OUT.tmp"
+    done
+  done
+
+  mv "$BENCH_OUT.tmp" "$BENCH_OUT" || exit 1
+  echo "bench: results written to $BENCH_OUT" >&2
+
+  if [ -n "$BENCH_BASELINE" ]; then
+    diffbaselines "$BENCH_BASELINE" "$BENCH_OUT"
+  fi
+}
+
+fps() {
+  # fps INSTANCE ALGORITHM [PARAMETERS...]
+  INST=$1
+  shift
+  "$UBCSAT" -alg "$@" -i "$INST" -runs "$BENCH_RUNS" -cutoff "$BENCH_FLIPS" -seed "$BENCH_SEED" \
+    -gtimeout "$BENCH_TIMEOUT" -r out null -rformat csv -r stats stdout fps 2>/dev/null |
+  awk -F, '$1 == "FlipsPerSecond" { print $2 }'
+}
+
+runparflip() {
+  mkdir -p "$BENCH_DIR" || exit 1
+
+  echo "hubdegree,algorithm,threads,serialfps,parallelfps,speedup" > "$PARFLIP_OUT.tmp"
+
+  for H in $PARFLIP_HUBS; do
+    INST="$BENCH_DIR/hub-$PARFLIP_CLAUSES-$H.cnf"
+    if [ ! -f "$INST" ]; then
+      echo "bench: generating $INST" >&2
+      "$GENCNF" -type hub -hubs "$H" -clauses "$PARFLIP_CLAUSES" -seed "$BENCH_SEED" -o "$INST" || exit 1
+    fi
+    DEGREE=`expr $PARFLIP_CLAUSES / 2 / $H`
+    for ALG in $PARFLIP_ALGS; do
+      echo "bench: hub degree $DEGREE $ALG" >&2
+      SERIAL=`fps "$INST" $ALG`
+      for T in $PARFLIP_THREADS; do
+        PARALLEL=`fps "$INST" $ALG -threads "$T" -parflip \`expr $DEGREE / 2\``
+        echo "$DEGREE,$ALG,$T,$SERIAL,$PARALLEL" |
+        awk -F, '{ printf "%s,%s,%s,%s,%s,%.3f\n", $1, $2, $3, $4, $5, ($4 > 0) ? $5 / $4 : 0 }' >> "$PARFLIP_OUT.tmp"
+      done
+    done
+  done
+
+  mv "$PARFLIP_OUT.tmp" "$PARFLIP_OUT" || exit 1
+  echo "bench: results written to $PARFLIP_OUT" >&2
+
+  awk -F, '
+    FNR == 1 { next }
+    {
+      printf "%10s %-12s %3s threads %12.0f %12.0f  x%s\n", $1, $2, $3, $4, $5, $6
+      key = $2 " " $3 " threads"
+      keys[key] = 1
+      if (($6 > 1.0) && ((!(key in crossover)) || ($1 + 0 < crossover[key]))) {
+        crossover[key] = $1 + 0
+      }
+    }
+    END {
+      for (key in keys) {
+        if (key in crossover) {
+          printf "crossover: %s at hub degree %d\n", key, crossover[key]
+        } else {
+          printf "crossover: %s not reached\n", key
+        }
+      }
+    }' "$PARFLIP_OUT"
+}
+
+checkone() {
+  # checkone INSTANCE COLUMN ALGORITHM...
+  INST=$1
+  COL=$2
+  shift 2
+  "$UBCSAT" -alg "$@" -i "$INST" -runs 3 -cutoff 20000 -seed 7 -r out null -rformat csv \
+    -r stats stdout "$COL" 2>/dev/null |
+  awk -F, -v name="$COL $* `basename $INST`" '
+    $1 ~ /BranchFactorMean_Mean$/ { found = 1; val = $2 }
+    END {
+      if ((!found) || (val < 0) || (val > 1)) {
+        printf "check: FAILED %s (%s)\n", name, val
+        exit 1
+      }
+    }'
+}
+
+runcheck() {
+  ALGS=`"$UBCSAT" -ha | sed -n 's/^-alg //p'`
+  WALGS=`"$UBCSAT" -hw | sed -n 's/^-alg //p'`
+
+  FAILED=`echo "$ALGS" | while read ALG; do
+    checkone sample.cnf branchfact $ALG >&2 || echo 1
+  done`
+  WFAILED=`echo "$WALGS" | while read ALG; do
+    checkone sample.wcnf branchfact_w $ALG >&2 || echo 1
+  done`
+
+  if [ -n "$FAILED$WFAILED" ]; then
+    exit 1
+  fi
+  echo "check: all passed" >&2
+}
+
+diffbaselines() {
+  [ -f "$1" ] || { echo "bench: cannot open $1" >&2; exit 2; }
+  [ -f "$2" ] || { echo "bench: cannot open $2" >&2; exit 2; }
+
+  awk -F, -v threshold="$BENCH_THRESHOLD" '
+    FNR == 1 { next }
+    FNR == NR { oldfps[$1 "," $2] = $4; oldrss[$1 "," $2] = $6; next }
+    {
+      key = $1 "," $2
+      if (!(key in oldfps)) {
+        printf "%-24s %-28s %12s %12s %8s  new\n", $1, $2, "-", $4, "-"
+        next
+      }
+      seen[key] = 1
+      status = ""
+      if ((oldfps[key] > 0) && ($4 != "")) {
+        change = sprintf("%+.1f%%", 100.0 * ($4 - oldfps[key]) / oldfps[key])
+        if (100.0 * (oldfps[key] - $4) / oldfps[key] > threshold) {
+          status = "REGRESSION"
+          regressions++
+        }
+      } else {
+        change = "-"
+      }
+      if ((oldrss[key] > 0) && ($6 > oldrss[key] * (1.0 + threshold / 100.0))) {
+        status = status " rss " oldrss[key] "->" $6 "KB"
+      }
+      printf "%-24s %-28s %12.0f %12.0f %8s  %s\n", $1, $2, oldfps[key], $4, change, status
+    }
+    END {
+      for (key in oldfps) {
+        if (!(key in seen)) {
+          split(key, parts, ",")
+          printf "%-24s %-28s %12s %12s %8s  missing\n", parts[1], parts[2], oldfps[key], "-", "-"
+        }
+      }
+      printf "%d regression(s) over %s%%\n", regressions, threshold
+      exit (regressions > 0)
+    }' "$1" "$2"
+}
+
+case "$1" in
+  run)
+    runall
+    ;;
+  parflip)
+    runparflip
+    ;;
+  check)
+    runcheck
+    ;;
+  diff)
+    [ $# -eq 3 ] || usage
+    diffbaselines "$2" "$3"
+    ;;
+  *)
+    usage
+    ;;
+esac
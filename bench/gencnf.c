@@ -0,0 +1,230 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    gencnf generates the instances used by the benchmark suite (make bench)
+
+    the generator has its own (xorshift) random number generator, so that
+    the same parameters & seed produce identical files on every platform
+
+    usage: gencnf -type ksat|struct|weighted|hub -clauses N [-k K] [-ratio R]
+                  [-hubs H] [-seed S] [-o FILE]
+
+    ksat      uniform random k-SAT, (N / ratio) variables
+    struct    k-SAT with community structure: the variables are partitioned
+              into communities of 100 variables, and 9 out of every 10
+              clauses are drawn from a single community
+    weighted  uniform random k-SAT (.wcnf) with integer clause weights [1,1000]
+    hub       k-SAT where half of the clauses contain one of H (default 10)
+              hub variables, so each hub variable occurs in ~N/(2H) clauses
+              (high degree variables, for the parallel flip benchmark)
+*/
+
+#define COMMUNITYSIZE 100
+#define INTRAPROB 90
+#define MAXWEIGHT 1000
+#define HUBPROB 50
+#define MAXK 64
+
+unsigned long iRandState;
+
+unsigned long NextRand() {
+  iRandState ^= (iRandState << 13) & 0xFFFFFFFFUL;
+  iRandState ^= (iRandState >> 17);
+  iRandState ^= (iRandState << 5) & 0xFFFFFFFFUL;
+  return(iRandState);
+}
+
+unsigned long RandInt(unsigned long iMax) {
+  return(NextRand() % iMax);
+}
+
+void Usage() {
+  fprintf(stderr,"usage: gencnf -type ksat|struct|weighted|hub -clauses N [-k K] [-ratio R] [-hubs H] [-seed S] [-o FILE]\n");
+  exit(1);
+}
+
+int main(int argc, char *argv[]) {
+
+  const char *sType = "ksat";
+  const char *sOutput = NULL;
+  unsigned long iNumClauses = 0;
+  unsigned long iNumVars;
+  unsigned long iK = 3;
+  unsigned long iSeed = 1;
+  unsigned long iNumCommunities = 1;
+  unsigned long iNumHubs = 10;
+  unsigned long iBase;
+  unsigned long iRange;
+  unsigned long aLits[MAXK];
+  unsigned long j,k,l;
+  double fRatio = 0.0;
+  int bWeighted;
+  int bStruct;
+  int bHub;
+  int bDuplicate;
+  int i;
+  FILE *filOut;
+
+  for (i=1;i<argc;i++) {
+    if (i + 1 >= argc) {
+      Usage();
+    }
+    if (strcmp(argv[i],"-type")==0) {
+      sType = argv[++i];
+    } else if (strcmp(argv[i],"-clauses")==0) {
+      iNumClauses = strtoul(argv[++i],NULL,10);
+    } else if (strcmp(argv[i],"-k")==0) {
+      iK = strtoul(argv[++i],NULL,10);
+    } else if (strcmp(argv[i],"-ratio")==0) {
+      fRatio = atof(argv[++i]);
+    } else if (strcmp(argv[i],"-hubs")==0) {
+      iNumHubs = strtoul(argv[++i],NULL,10);
+    } else if (strcmp(argv[i],"-seed")==0) {
+      iSeed = strtoul(argv[++i],NULL,10);
+    } else if (strcmp(argv[i],"-o")==0) {
+      sOutput = argv[++i];
+    } else {
+      Usage();
+    }
+  }
+
+  bWeighted = (strcmp(sType,"weighted")==0);
+  bStruct = (strcmp(sType,"struct")==0);
+  bHub = (strcmp(sType,"hub")==0);
+
+  if ((!bWeighted) && (!bStruct) && (!bHub) && (strcmp(sType,"ksat"))) {
+    Usage();
+  }
+
+  if ((iNumClauses == 0) || (iK < 2) || (iK > MAXK) || (bHub && (iNumHubs == 0))) {
+    Usage();
+  }
+
+  /* default ratios: near the k-SAT threshold, and over-constrained for MAX-SAT */
+
+  if (fRatio <= 0.0) {
+    switch (iK) {
+      case 2:  fRatio = 1.0; break;
+      case 3:  fRatio = 4.2; break;
+      case 4:  fRatio = 9.9; break;
+      case 5:  fRatio = 21.1; break;
+      default: fRatio = (double) (1UL << iK) * 0.69; break;
+    }
+    if (bWeighted) {
+      fRatio *= 1.5;
+    }
+  }
+
+  iNumVars = (unsigned long) ((double) iNumClauses / fRatio);
+  if (iNumVars < iK * 2) {
+    iNumVars = iK * 2;
+  }
+  if (bHub && (iNumVars < iNumHubs + iK * 2)) {
+    iNumVars = iNumHubs + iK * 2;
+  }
+
+  if (bStruct) {
+    iNumCommunities = iNumVars / COMMUNITYSIZE;
+    if (iNumCommunities < 2) {
+      iNumCommunities = 1;
+    } else {
+      iNumVars = iNumCommunities * COMMUNITYSIZE;
+    }
+  }
+
+  iRandState = (iSeed * 2654435761UL + 0x9E3779B9UL) & 0xFFFFFFFFUL;
+  if (iRandState == 0) {
+    iRandState = 0x9E3779B9UL;
+  }
+
+  if (sOutput) {
+    filOut = fopen(sOutput,"w");
+    if (filOut == NULL) {
+      fprintf(stderr,"gencnf: cannot open %s\n",sOutput);
+      return(1);
+    }
+  } else {
+    filOut = stdout;
+  }
+
+  fprintf(filOut,"c gencnf -type %s -clauses %lu -k %lu -ratio %g -seed %lu\n",sType,iNumClauses,iK,fRatio,iSeed);
+  fprintf(filOut,"p %s %lu %lu\n",bWeighted ? "wcnf" : "cnf",iNumVars,iNumClauses);
+
+  for (j=0;j<iNumClauses;j++) {
+
+    iBase = 0;
+    iRange = iNumVars;
+
+    if ((bStruct) && (iNumCommunities > 1) && (RandInt(100) < INTRAPROB)) {
+      iBase = RandInt(iNumCommunities) * COMMUNITYSIZE;
+      iRange = COMMUNITYSIZE;
+    }
+
+    k = 0;
+
+    /* hub variables are 1..iNumHubs, the other literals are drawn from the rest */
+
+    if (bHub) {
+      if (RandInt(100) < HUBPROB) {
+        aLits[k++] = RandInt(iNumHubs) + 1;
+      }
+      iBase = iNumHubs;
+      iRange = iNumVars - iNumHubs;
+    }
+
+    for (;k<iK;k++) {
+      do {
+        aLits[k] = iBase + RandInt(iRange) + 1;
+        bDuplicate = 0;
+        for (l=0;l<k;l++) {
+          if (aLits[l] == aLits[k]) {
+            bDuplicate = 1;
+          }
+        }
+      } while (bDuplicate);
+    }
+
+    if (bWeighted) {
+      fprintf(filOut,"%lu ",RandInt(MAXWEIGHT) + 1);
+    }
+
+    for (k=0;k<iK;k++) {
+      if (RandInt(2)) {
+        fprintf(filOut,"-");
+      }
+      fprintf(filOut,"%lu ",aLits[k]);
+    }
+    fprintf(filOut,"0\n");
+  }
+
+  if (sOutput) {
+    fclose(filOut);
+  }
+
+  return(0);
+}
+
@@ -149,6 +149,8 @@ void DistributeDDFW() {
 
     aClausePenaltyINT[iCurrentClause] += iPenaltyChange;
     aClausePenaltyINT[iSourceClause] -= iPenaltyChange;
+    PenaltyStatsChange(iCurrentClause);
+    PenaltyStatsChange(iSourceClause);
 
     /* For the current clause, the 'make' score for each variable has to be increased */
 
@@ -54,7 +54,7 @@ void AddDerandomized() {
     "DefaultProcedures,Flip+FalseClauseList",
     "default","default");
 
-  CreateTrigger("PickDCRWalk",ChooseCandidate,PickDCRWalk,"ClausePickCount,NextClauseLit,UnsatCounts","UpdateUnsatCounts,UpdateNextClauseLit,UpdateClausePickCount");
+  CreateTrigger("PickDCRWalk",ChooseCandidate,PickDCRWalk,"ClausePickCount,NextClauseLit,UnsatCounts","SyncUnsatCounts,UpdateUnsatCounts,FinalUnsatCounts,UpdateNextClauseLit,UpdateClausePickCount");
 
   CreateTrigger("CreateClausePickCount",CreateStateInfo,CreateClausePickCount,"","");
   CreateTrigger("InitClausePickCount",InitStateInfo,InitClausePickCount,"","");
@@ -75,7 +75,7 @@ void AddDerandomized() {
 
   AddParmProbability(&pCurAlg->parmList,"-wp","pseudo-walk probability [default %s]","with frequency 1/PR, select a variable~from a an unsat clause to flip","",&iWp,0.01);
 
-  CreateTrigger("PickDANOVP",ChooseCandidate,PickDANOVP,"ClausePickCount,NextClauseLit,UnsatCounts","UpdateUnsatCounts,UpdateClausePickCount,UpdateNextClauseLit");
+  CreateTrigger("PickDANOVP",ChooseCandidate,PickDANOVP,"ClausePickCount,NextClauseLit,UnsatCounts","SyncUnsatCounts,UpdateUnsatCounts,FinalUnsatCounts,UpdateClausePickCount,UpdateNextClauseLit");
 
   CreateTrigger("InitAdaptNoveltyNoiseDet",PostInit,InitAdaptNoveltyNoiseDet,"","");
   CreateTrigger("AdaptNoveltyNoiseDet",PostFlip,AdaptNoveltyNoiseDet,"InitAdaptNoveltyNoiseDet","");
@@ -42,7 +42,7 @@ void AddG2WSat() {
    "G2WSAT: Gradient-based Greedy WalkSAT (uses Novelty++)",
     "Li, Huang  [SAT 05]",
     "PickG2WSat",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromBest,FalseClauseList,VarLastChange",
     "default","default");
   
   CopyParameters(pCurAlg,"novelty++","",FALSE);
@@ -53,7 +53,7 @@ void AddG2WSat() {
     "G2WSAT: Gradient-based Greedy WalkSAT (weighted)",
     "Li, Huang  [SAT 05]",
     "PickG2WSatW",
-    "DefaultProceduresW,Flip+TrackChanges+FCL+W,DecPromVarsW,FalseClauseList,VarLastChange",
+    "DefaultProceduresW,Flip+TrackChanges+FCL+W,DecPromVarsW,DecPromBestW,FalseClauseList,VarLastChange",
     "default_w","default");
 
   CopyParameters(pCurAlg,"g2wsat","",FALSE);
@@ -64,7 +64,7 @@ void AddG2WSat() {
    "G2WSAT: Gradient-based Greedy WalkSAT (uses Nov+ & oldest dec. prom var)",
     "Li, Wei, and Zhang [SAT 07]",
     "PickG2WSatNoveltyPlusOldest",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromOldest,FalseClauseList,VarLastChange",
     "default","default");
   
   CopyParameters(pCurAlg,"novelty+","",FALSE);
@@ -75,7 +75,7 @@ void AddG2WSat() {
     "G2WSAT: uses Nov+ & oldest dec. prom var) (weighted)",
     "Li, Wei, and Zhang [SAT 07]",
     "PickG2WSatNoveltyPlusOldestW",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromOldest,FalseClauseList,VarLastChange",
     "default","default");
   
   CopyParameters(pCurAlg,"novelty+","",FALSE);
@@ -87,7 +87,7 @@ void AddG2WSat() {
    "G2WSAT+p: Gradient-based Greedy WalkSAT with look-ahead (uses Novelty+p)",
     "Li, Wei, Zhang  [SAT 07]",
     "PickG2WSatP",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange,LookAhead",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromOldest,FalseClauseList,VarLastChange,LookAhead",
     "default","default");
   
   CopyParameters(pCurAlg,"novelty+p","",FALSE);
@@ -99,7 +99,7 @@ void AddG2WSat() {
    "Adaptive G2WSat: Adaptive G2WSAT (uses Nov+, Oldest DecPromVar)",
     "Li, Wei, Zhang  [SAT 07]",
     "PickG2WSatNoveltyPlusOldest",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange,AdaptG2WSatNoise",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromOldest,FalseClauseList,VarLastChange,AdaptG2WSatNoise",
     "default","default");
   
   CopyParameters(pCurAlg,"g2wsat","novelty+oldest",FALSE);
@@ -112,7 +112,7 @@ void AddG2WSat() {
    "Adapt+G2WSat+p: Adaptive G2WSAT+p",
     "Li, Wei, Zhang  [SAT 07]",
     "PickG2WSatP",
-    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,FalseClauseList,VarLastChange,LookAhead,AdaptG2WSatNoise",
+    "DefaultProcedures,Flip+TrackChanges+FCL,DecPromVars,DecPromOldest,FalseClauseList,VarLastChange,LookAhead,AdaptG2WSatNoise",
     "default","default");
 
   CopyParameters(pCurAlg,"g2wsat+p","",FALSE);
@@ -120,36 +120,15 @@ void AddG2WSat() {
 
 
 void PickG2WSat() {
- 
-  UINT32 j;
-  UINT32 iVar;
-  SINT32 iScore;
 
   /* If there are Decreasing Promising Variables */
 
   if (iNumDecPromVars > 0 ) {
 
-    /* Find the one with the 'best' score */
-
-    iFlipCandidate = aDecPromVarsList[0];
-    iBestScore = aVarScore[iFlipCandidate];        
-    for (j=1;j<iNumDecPromVars;j++) {
-      iVar = aDecPromVarsList[j];
-      iScore = aVarScore[iVar];
-      if (iScore < iBestScore) {
-        iFlipCandidate = iVar;
-        iBestScore = iScore;
-      } else {
-
-        /* If there is a tie, prefer the 'oldest' variable */
-
-        if (iScore == iBestScore) {
-          if (aVarLastChange[iVar] < aVarLastChange[iFlipCandidate]) {
-            iFlipCandidate = iVar;
-          }
-        }
-      }
-    }
+    /* Find the one with the 'best' score (if there is a tie, prefer the 'oldest' variable) */
+
+    iFlipCandidate = hDecPromBest.aHeap[0];
+    iBestScore = aVarScore[iFlipCandidate];
   } else {
 
     /* Otherwise, just use Novelty++ */
@@ -161,37 +140,16 @@ void PickG2WSat() {
 void PickG2WSatW() {
 
   /* weighted varaint -- see regular algorithm for comments */
- 
-  UINT32 j;
-  UINT32 iVar;
-  FLOAT fScore;
 
   if (iNumDecPromVarsW > 0 ) {
-    iFlipCandidate = aDecPromVarsListW[0];
+    iFlipCandidate = hDecPromBestW.aHeap[0];
     fBestScore = aVarScoreW[iFlipCandidate];
-    for (j=1;j<iNumDecPromVarsW;j++) {
-      iVar = aDecPromVarsListW[j];
-      fScore = aVarScoreW[iVar];
-      if (fScore < fBestScore) {
-        iFlipCandidate = iVar;
-        fBestScore = aVarScoreW[iVar];
-      } else {
-        if (fScore == fBestScore) {
-          if (aVarLastChange[iVar] < aVarLastChange[iFlipCandidate]) {
-            iFlipCandidate = iVar;
-          }
-        }
-      }
-    }
   } else {
     PickNoveltyPlusPlusW();
   }
 }
 
 void PickG2WSatNoveltyPlusOldest() {
- 
-  UINT32 j;
-  UINT32 iVar;
 
   /* If there are Decreasing Promising Variables */
 
@@ -199,13 +157,7 @@ void PickG2WSatNoveltyPlusOldest() {
 
     /* Find the one with that is the 'oldest' */
 
-    iFlipCandidate = aDecPromVarsList[0];
-    for (j=1;j<iNumDecPromVars;j++) {
-      iVar = aDecPromVarsList[j];
-      if (aVarLastChange[iVar] < aVarLastChange[iFlipCandidate]) {
-        iFlipCandidate = iVar;
-      }
-    }
+    iFlipCandidate = hDecPromOldest.aHeap[0];
   } else {
 
     /* Otherwise, just use Novelty+ (not Novelty++ as with regular G2WSat */
@@ -218,18 +170,9 @@ void PickG2WSatNoveltyPlusOldest() {
 void PickG2WSatNoveltyPlusOldestW() {
 
   /* weighted varaint -- see regular algorithm for comments */
- 
-  UINT32 j;
-  UINT32 iVar;
 
   if (iNumDecPromVars > 0 ) {
-    iFlipCandidate = aDecPromVarsList[0];
-    for (j=1;j<iNumDecPromVars;j++) {
-      iVar = aDecPromVarsList[j];
-      if (aVarLastChange[iVar] < aVarLastChange[iFlipCandidate]) {
-        iFlipCandidate = iVar;
-      }
-    }
+    iFlipCandidate = hDecPromOldest.aHeap[0];
   } else {
     PickNoveltyPlusW();
   }
@@ -237,8 +180,6 @@ void PickG2WSatNoveltyPlusOldestW() {
 
 
 void PickG2WSatP() {
- 
-  UINT32 j;
 
   /* If there are Decreasing Promising Variables */
 
@@ -246,12 +187,7 @@ void PickG2WSatP() {
 
     /* Find the one with that is the 'oldest' */
 
-    iFlipCandidate = aDecPromVarsList[0];
-    for (j=1;j<iNumDecPromVars;j++) {
-      if (aVarLastChange[aDecPromVarsList[j]] < aVarLastChange[iFlipCandidate]) {
-        iFlipCandidate = aDecPromVarsList[j];
-      }
-    }
+    iFlipCandidate = hDecPromOldest.aHeap[0];
   } else {
 
     /* Otherwise, just use Novelty+p */
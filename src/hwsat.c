@@ -33,7 +33,7 @@ void AddHWSat() {
     "HWSAT: HSAT with random walk",
     "Gent, Walsh [Hybrid Problems... 95]",
     "PickHWSat",
-    "DefaultProcedures,Flip+VarScore,VarLastChange,FalseClauseList",
+    "DefaultProcedures,Flip+FalseClauseList,VarScore,VarLastChange",
     "default","default");
   
   AddParmProbability(&pCurAlg->parmList,"-wp","walk probability [default %s]","with probability PR, select a random variable from those~that appear in unsat clauses","",&iWp,0.10);
@@ -44,7 +44,7 @@ void AddHWSat() {
     "HWSAT: HSAT with random walk (weighted)",
     "Gent, Walsh [Hybrid Problems... 95]",
     "PickHWSatW",
-    "DefaultProceduresW,Flip+VarScoreW,VarLastChange,FalseClauseList",
+    "DefaultProceduresW,Flip+FalseClauseListW,VarScoreW,VarLastChange",
     "default_w","default");
   
   CopyParameters(pCurAlg,"hwsat","",FALSE);
@@ -51,11 +51,21 @@ UINT32 iIrotsMode;
 
 UINT32 *aIrotsBackup;
 
+/* the journal holds each variable flipped since the last backup, so that
+   the backup & restore only have to visit the variables that changed */
+
+UINT32 *aIrotsJournal;
+UINT32 *aIrotsInJournal;
+UINT32 iIrotsJournalLen;
+BOOL bIrotsJournalValid;
+
 void InitIRoTSParms();
 void InitIRoTS();
 void PostStepIRoTS();
 
 void CreateIRoTSBackup();
+void InitIRoTSJournal();
+void ClearIRoTSJournal();
 void IRoTSBackup();
 void IRoTSRestore();
 
@@ -79,9 +89,10 @@ void AddIRoTS() {
 
   CreateTrigger("InitIRoTSParms",PreStart,InitIRoTSParms,"","");
   CreateTrigger("InitIRoTS",PreRun,InitIRoTS,"","");
-  CreateTrigger("PostStepIRoTS",PostStep,PostStepIRoTS,"InitIRoTS,InitIRoTSParms","");
+  CreateTrigger("PostStepIRoTS",PostStep,PostStepIRoTS,"InitIRoTS,InitIRoTSParms,InitIRoTSJournal","");
 
   CreateTrigger("CreateIRoTSBackup",CreateStateInfo,CreateIRoTSBackup,"","");
+  CreateTrigger("InitIRoTSJournal",PostInit,InitIRoTSJournal,"","");
 
   pCurAlg = CreateAlgorithm("irots","",TRUE,
     "IRoTS: Iterated Robust TABU Search (weighted)",
@@ -138,6 +149,13 @@ void PostStepIRoTS() {
   BOOL bSave = FALSE;
   BOOL bRestore = FALSE;
 
+  /* add the flipped variable to the journal */
+
+  if ((iFlipCandidate) && (!aIrotsInJournal[iFlipCandidate])) {
+    aIrotsInJournal[iFlipCandidate] = TRUE;
+    aIrotsJournal[iIrotsJournalLen++] = iFlipCandidate;
+  }
+
   /* after a regular IRoTS step, the process depends on what
      'mode' the solver is in */
 
@@ -287,13 +305,7 @@ void PostStepIRoTS() {
   }
 
   if (bRestore) {
-    
     IRoTSRestore();
-
-    /* after restoring the variables, we must reset all state information */
-
-    RunProcedures2(InitStateInfo);
-    RunProcedures2(PostInit);
   }
 
 }
@@ -301,19 +313,98 @@ void PostStepIRoTS() {
 
 void CreateIRoTSBackup() {
   aIrotsBackup = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  aIrotsJournal = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  aIrotsInJournal = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  memset(aIrotsInJournal,0,(iNumVars+1)*sizeof(UINT32));
+  iIrotsJournalLen = 0;
+}
+
+void InitIRoTSJournal() {
+  
+  /* all of the variables have been (re-)initialized, so the
+     next backup must copy every variable */
+
+  bIrotsJournalValid = FALSE;
+}
+
+void ClearIRoTSJournal() {
+  UINT32 j;
+  for (j=0;j<iIrotsJournalLen;j++) {
+    aIrotsInJournal[aIrotsJournal[j]] = FALSE;
+  }
+  iIrotsJournalLen = 0;
+  bIrotsJournalValid = TRUE;
 }
 
 void IRoTSBackup() {
   UINT32 j;
-  for (j=1;j<=iNumVars;j++) {
-    aIrotsBackup[j] = aVarValue[j];
+  if (bIrotsJournalValid) {
+    for (j=0;j<iIrotsJournalLen;j++) {
+      aIrotsBackup[aIrotsJournal[j]] = aVarValue[aIrotsJournal[j]];
+    }
+  } else {
+    for (j=1;j<=iNumVars;j++) {
+      aIrotsBackup[j] = aVarValue[j];
+    }
   }
+  ClearIRoTSJournal();
 }
 
 void IRoTSRestore() {
   UINT32 j;
-  for (j=1;j<=iNumVars;j++) {
-    aVarValue[j] = aIrotsBackup[j];
+  UINT32 iVar;
+  UINT32 iNumDiff;
+  UINT32 iClauseVisits;
+  UINT32 iSaveFlipCandidate;
+
+  /* the variables in the journal that differ from the backup are moved
+     to the front of the journal */
+
+  iNumDiff = 0;
+  iClauseVisits = 0;
+
+  for (j=0;j<iIrotsJournalLen;j++) {
+    iVar = aIrotsJournal[j];
+    if (aVarValue[iVar] != aIrotsBackup[iVar]) {
+      aIrotsJournal[j] = aIrotsJournal[iNumDiff];
+      aIrotsJournal[iNumDiff++] = iVar;
+      iClauseVisits += aNumLitOcc[GetPosLit(iVar)] + aNumLitOcc[GetNegLit(iVar)];
+    }
   }
-}
 
+  /* a full reset of the state information visits every literal once,
+     and flipping a variable visits (roughly) every literal of each clause
+     it appears in, so the flips are only replayed when they touch
+     fewer clauses than there are in the instance */
+
+  if ((bIrotsJournalValid) && (iClauseVisits < iNumClauses)) {
+
+    iSaveFlipCandidate = iFlipCandidate;
+
+    /* (the replayed flips are not search steps, so they are not counted by the statistics) */
+
+    for (j=0;j<iNumDiff;j++) {
+      iFlipCandidate = aIrotsJournal[j];
+      ReplayFlipStateInfo();
+    }
+
+    iFlipCandidate = iSaveFlipCandidate;
+
+    /* as with a full reset, no variable is tabu after a restore */
+
+    InitVarLastChange();
+
+  } else {
+
+    for (j=1;j<=iNumVars;j++) {
+      aVarValue[j] = aIrotsBackup[j];
+    }
+
+    /* after restoring the variables, we must reset all state information */
+
+    RunProcedures2(InitStateInfo);
+    RunProcedures2(PostInit);
+  }
+
+  ClearIRoTSJournal();
+}
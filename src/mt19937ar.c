@@ -138,6 +138,21 @@ unsigned long genrand_int32(void)
     return y;
 }
 
+/* copies the generator state out of / back into mt[] (for checkpoints) */
+void get_genrand_state(unsigned long *state, int *pos)
+{
+    int i;
+    for (i=0;i<N;i++) state[i] = mt[i];
+    *pos = mti;
+}
+
+void set_genrand_state(unsigned long *state, int pos)
+{
+    int i;
+    for (i=0;i<N;i++) mt[i] = state[i];
+    mti = pos;
+}
+
 /* generates a random number on [0,0x7fffffff]-interval */
 long genrand_int31(void)
 {
@@ -23,7 +23,6 @@
 #include "ubcsat.h"
 
 void PickNoveltyPlusP();
-void InitLookAhead();
 void CreateLookAhead();
 SINT32 BestLookAheadScore(UINT32 iLookVar);
 
@@ -43,8 +42,7 @@ void AddNoveltyPlusP() {
   CreateTrigger("PickNoveltyPlusP",ChooseCandidate,PickNoveltyPlusP,"","");
 
   CreateTrigger("CreateLookAhead",CreateStateInfo,CreateLookAhead,"","");
-  CreateTrigger("InitLookAhead",InitStateInfo,InitLookAhead,"","");
-  CreateContainerTrigger("LookAhead","CreateLookAhead,InitLookAhead");
+  CreateContainerTrigger("LookAhead","CreateLookAhead");
 
 }
 
@@ -165,20 +163,24 @@ void PickNoveltyPlusP() {
 }
 
 
-UINT32 *aIsLookAhead;
+/*
+    the look ahead table is stamped with an epoch (one per look ahead),
+    so it never has to be cleared (after each look ahead or at each restart)
+*/
+
+UINT32 *aLookAheadStamp;
 UINT32 *aLookAheadList;
 SINT32 *aLookAheadScoreChange;
+UINT32 iLookAheadEpoch;
 
-#define UpdateLookAhead(var,diff) {if(aIsLookAhead[var]==FALSE) {aIsLookAhead[var]=TRUE; aLookAheadList[iNumLookAhead++] = var; aLookAheadScoreChange[var] = (diff);} else {aLookAheadScoreChange[var] += (diff);}};
+#define UpdateLookAhead(var,diff) {if(aLookAheadStamp[var]!=iLookAheadEpoch) {aLookAheadStamp[var]=iLookAheadEpoch; aLookAheadList[iNumLookAhead++] = var; aLookAheadScoreChange[var] = (diff);} else {aLookAheadScoreChange[var] += (diff);}};
 
 void CreateLookAhead() {
-  aIsLookAhead = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aLookAheadStamp = AllocateRAM((iNumVars+1) * sizeof(UINT32));
   aLookAheadList = AllocateRAM((iNumVars+1) * sizeof(UINT32));
   aLookAheadScoreChange = AllocateRAM((iNumVars+1) * sizeof(SINT32));
-}
-
-void InitLookAhead() {
-  memset(aIsLookAhead,0,(iNumVars+1) * sizeof(UINT32));
+  memset(aLookAheadStamp,0,(iNumVars+1) * sizeof(UINT32));
+  iLookAheadEpoch = 0;
 }
 
 SINT32 BestLookAheadScore(UINT32 iLookVar) {
@@ -198,6 +200,15 @@ SINT32 BestLookAheadScore(UINT32 iLookVar) {
   }
 
   iNumLookAhead = 0;
+  iLookAheadEpoch++;
+
+  /* when the epoch wraps (UINT32 is 32 bits on WIN32), the stamps of old
+     epochs could match again, so the table is cleared once */
+
+  if (iLookAheadEpoch == 0) {
+    memset(aLookAheadStamp,0,(iNumVars+1) * sizeof(UINT32));
+    iLookAheadEpoch = 1;
+  }
 
   /* Add all Decreasing Promising variables to the 'best lookahead' list */
 
@@ -290,7 +301,6 @@ SINT32 BestLookAheadScore(UINT32 iLookVar) {
         }
       }
     }
-    aIsLookAhead[iVar] = FALSE;
   }
   
   /* only consider 'improving' look ahead scores */
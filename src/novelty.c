@@ -124,7 +124,7 @@ void AddNoveltyPlusPlus() {
   
   CopyParameters(pCurAlg,"novelty++","",FALSE);
 
-  CreateTrigger("PickNoveltyPlusW",ChooseCandidate,PickNoveltyPlusW,"","");
+  CreateTrigger("PickNoveltyPlusPlusW",ChooseCandidate,PickNoveltyPlusPlusW,"","");
 
 }
 
@@ -42,6 +42,7 @@ void AddParameters() {
   AddParmUInt(&parmUBCSAT,"-cutoff","maximum number of search steps per run [default %s]","you can specify \"-cutoff max\" for largest integer limit","",&iCutoff,100000);
   AddParmFloat(&parmUBCSAT,"-timeout","maximum number of seconds per run","each run will terminate unsuccessfully after FL seconds,~or when the -cutoff is reached: whichever happens first~so use \"-cutoff max\" to ensure timeout times are reached","CheckTimeout",&fTimeOut,FLOATZERO);
   AddParmFloat(&parmUBCSAT,"-gtimeout","global timeout: maximum number of seconds for all runs","the current run and all remaining runs will terminate~after FL seconds","CheckTimeout",&fGlobalTimeOut,FLOATZERO);
+  AddParmFloat(&parmUBCSAT,"-rtdprecision","stop the runs once the run-length distribution is estimated to a relative error of FL","the estimate (see -r rtdest) is updated every 1 + n/32 runs (n: the # of runs so far),~and the runs stop once the 95 percent bounds of the median # of steps (or of the success probability~while it is below 0.5) are within FL of it (after at least 10 runs)~-runs is still the maximum # of runs","RTDEstimate",&fRTDPrecision,FLOATZERO);
   AddParmUInt(&parmUBCSAT,"-noimprove","terminate run if no improvement in INT steps","if no improvement in the solution quality has been made~in INT steps, then the run will terminate~(for solution quality description see -target and -wtarget)","NoImprove",&iNoImprove,0);
   
   AddParmUInt(&parmUBCSAT,"-target","target solution quality","for regular (unweighted) algorithms, the solution quality~is measured as the number of false clauses~~for MAX-SAT (or for some other reason) you can set~the desired solution quality so that solution is found if~the number false clauses <= target~~default target solution quality is zero (no false clauses)","",&iTarget,0);
@@ -56,9 +57,31 @@ void AddParameters() {
   AddParmUInt(&parmUBCSAT,"-srestart","static (periodic) restart every INT steps","in UBCSAT restarts do not terminate a run, and several~restarts can occur within a single run","CheckForRestarts",&iPeriodicRestart,0);
   AddParmProbability(&parmUBCSAT,"-prestart","probabilistically restart at each step with probability PR","","CheckForRestarts",&iProbRestart,FLOATZERO);
   AddParmUInt(&parmUBCSAT,"-drestart","dynamic restart if no improvement in INT steps","similar to (-noimprove), except that -drestart restarts~the algorithm within the run instead of terminating the run","CheckForRestarts,BestFalse",&iStagnateRestart,0);
+  AddParmString(&parmUBCSAT,"-restartpolicy","restart with the policy STR (luby, geometric or adaptive)","luby: the Luby sequence (1,1,2,1,1,2,4,...) x -restartbase steps~geometric: -restartbase steps, then x -restartfactor after each restart~adaptive: fits a Weibull distribution to the tries of the previous runs~and uses the restart length with the lowest expected # of steps~(or no restarts if the tail is not heavy), and luby until 5 tries succeed","RestartPolicy",&sRestartPolicy,"");
+  AddParmUInt(&parmUBCSAT,"-restartbase","base # of steps for -restartpolicy [default %s = # of variables]","","",&iRestartBase,0);
+  AddParmFloat(&parmUBCSAT,"-restartfactor","growth factor of -restartpolicy geometric [default %s]","","",&fRestartFactor,1.5);
+  AddParmBool(&parmUBCSAT,"-increstart","incremental restarts","at a restart, the new assignment is reached by flipping~the variables that change, instead of re-initializing all~of the state information (if fewer clauses are affected)","IncRestart",&bIncRestart,FALSE);
+
+  AddParmUInt(&parmUBCSAT,"-threads","number of threads used to build the state information [default %s]","the clause occurrence lists and the initial state information~(true literal counts, scores, make/break) are built in parallel~for large instances (at least 65536 clauses per thread)~the search itself is not parallel (see -parflip), and results are~identical for any number of threads","",&iNumThreads,1);
+
+  AddParmUInt(&parmUBCSAT,"-parflip","flip variables that occur in at least N clauses in parallel [default %s]","with -threads, the occurrence lists of high degree variables are~split across a pool of threads for each flip (the results are identical)~supported by algorithms that use the flip procedures~Flip+FalseClauseList, Flip+MakeBreak or Flip+MBPFL+FCL+VIF~0 disables parallel flips (see make bench-parflip for the crossover point)","ParFlip",&iParFlipOcc,0);
+
+  AddParmUInt(&parmUBCSAT,"-coop","number of cooperating search processes [default %s]","N-1 copies of ubcsat (each with its own seed) search the same~instance, and every (-coopint) steps they exchange their best~assignments and clause penalties through shared memory~a process with a worse best assignment continues from the better~one (or a crossover), and the clause penalties of the others~are blended in with weight (-coopblend)~only this process reports, the others exit when it is done","Coop",&iCoopWorkers,1);
+  AddParmUInt(&parmUBCSAT,"-coopint","steps between -coop exchanges [default %s]","","",&iCoopInterval,10000);
+  AddParmFloat(&parmUBCSAT,"-coopblend","weight of the shared clause penalties [default %s]","0 keeps the clause penalties of each process~the shared penalties are scaled to the total of the process","",&fCoopBlend,0.5);
+  AddParmProbability(&parmUBCSAT,"-coopcross","probability of a crossover with a better assignment [default %s]","otherwise the better assignment is copied~(a solution is always copied)","",&iCoopCross,0.5);
+
+  AddParmUInt(&parmUBCSAT,"-workers","number of worker processes for the runs [default %s]","this process becomes the coordinator: it hands out the runs~and seeds to N forked workers, and reports the runs in order~as if they had been serial (including -find and -findunique)~only the reports built from columns (out, stats, rtd) and~the solutions are collected from the workers","Farm",&iFarmWorkers,0);
+  AddParmString(&parmUBCSAT,"-coordinator","also accept workers on the Unix socket FILE","workers started with (-worker FILE) and the same instance &~parameters can join (and leave) at any time","Farm",&sFarmCoordinator,"");
+  AddParmString(&parmUBCSAT,"-worker","search the runs given by the coordinator at FILE","this process does not report","Farm",&sFarmWorker,"");
+
+  AddParmString(&parmUBCSAT,"-serve","serve requests on the Unix socket FILE","the instance is read from each request (a line of parameters~followed by the .cnf or .wcnf) and the reply has the best~assignment found: c, o, s & v lines as in the competitions~the parameters of the algorithm and -runs, -cutoff, -timeout,~-gtimeout, -target, -wtarget, -seed & -find can be in a request","Serve",&sServeSocket,"");
+  AddParmUInt(&parmUBCSAT,"-serveworkers","number of worker processes serving requests [default %s]","a worker that exits (e.g., on a bad request) is restarted","Serve",&iServeWorkers,1);
 
   AddParmString(&parmIO,"-inst,-i","specify input instance file: (.cnf) or (.wcnf) format","if no file is specified, then UBCSAT reads from stdin~example: ubcsat < sample.cnf","",&sFilenameIn,"");
 
+  AddParmString(&parmIO,"-instlist","solve each instance listed in FILE (one file name per line)","batch mode: the instances are solved in turn by the same process~use - to read the file names from stdin as they arrive~the out and stats reports are replaced by (-r batch),~which prints one row for each instance","Batch",&sFilenameInstList,"");
+
   AddParmString(&parmIO,"-varinitfile","variable initialization file","variables are initialized to specific values at the~start of each run and at restarts~~Example file:~  -1 3 -4 9 ~sets variables (3,9) to true and variables (1,4) to false~and all other variables would be initialized randomly","",&sFilenameVarInit,"");
   AddParmUInt(&parmIO,"-varinitflip","flip INT variables after initialization","forces INT (unique) random variables to be flipped~after initialization","CandidateList",&iInitVarFlip,0);
   AddParmBool(&parmIO,"-varinitgreedy","greedy variable initialization","if a variable appears more often as a positive literal~then the var is initialized to true (and vice-versa)~for vars with ties, it alternates between true and false~this initialization is deterministic","",&bVarInitGreedy,FALSE);
@@ -69,6 +92,10 @@ void AddParameters() {
 
   AddParmBool(&parmIO, "-recho","all reports directed to files will also be echoed to stdout","","",&bReportEcho,FALSE);
   AddParmBool(&parmIO, "-rflush","all report buffers are flushed before each run","","FlushBuffers",&bReportFlush,FALSE);
+  AddParmString(&parmIO, "-rformat","output format for the out, rtd, stats, batch, cnfstats and falsehist reports: text (default), json, csv or bin","json: one object per line (the column schema first, then one per row)~csv: a header line of column IDs, then one line per row~bin: 64-bit little-endian integers and IEEE doubles~all non-text formats imply -rclean","ReportFormat",&sReportFormat,"text");
+  AddParmBool(&parmIO, "-rstream","stats report uses bounded memory (no data stored per run)","mean, stddev, etc. are calculated incrementally and the median and~quantiles are estimated from a sketch (exact for up to 1024 runs)~useful with a very large number of runs~reports that list every run (rtd, delayed out) still store all runs","",&bReportStream,FALSE);
+  AddParmFloat(&parmIO, "-statsample","calculate the sampled step statistics every FL steps (integer FL >= 1) or with probability FL (FL < 1) [default %s]","sampled: the mean, stddev and cv of the step columns (min and max use every step),~the distance, disthist and falsehist reports and fdc~(the histograms count the samples, and their windows are in samples)~the search is not affected","StatSample",&fStatSample,1.0f);
+  AddParmUInt(&parmIO, "-mobsample","calculate the (-r mobility) windows every INT steps [default %s]","the mean for each window length is over the steps calculated~(-r mobfixed, mobfixedfreq and the mob columns are not sampled)","",&iMobilitySample,1);
   AddParmBool(&parmIO, "-rclean","suppress all report header output","","",&bReportClean,FALSE);
 
   AddParmString(&parmIO, "-rcomment","specify comment character for report headers (# is default)","","",&sCommentString,"#");
@@ -79,4 +106,10 @@ void AddParameters() {
 
   AddParmString(&parmIO,"-fileabort,-fa","specify a signal file to terminate all remaining runs","during a long execution with numerous runs, you can create~an abort file (the contents of the file are not important)~to prevent any remaining runs from starting...~the current run will finish and all reports will finish","FileAbort",&sFilenameAbort,"");
 
+  AddParmBool(&parmIO,"-signals","catch SIGINT, SIGTERM and SIGUSR1 to end the search cleanly","SIGINT or SIGTERM will terminate the current run and all remaining runs~SIGUSR1 will let the current run finish and prevent any remaining runs~all reports will finish (a second SIGINT/SIGTERM exits immediately)","CatchSignals",&bCatchSignals,FALSE);
+
+  AddParmString(&parmIO,"-checkpoint,-ckpt","specify a file to write a checkpoint to when a signal is caught","implies -signals: on SIGINT/SIGTERM the search state of the current run~(assignment, clause penalties, random state, step #) is saved,~on SIGUSR1 the checkpoint is saved after the current run~the results of all completed runs are also saved","WriteCheckpoint",&sFilenameCheckpoint,"");
+
+  AddParmString(&parmIO,"-resume","specify a checkpoint file to resume from","use the same instance, algorithm, parameters and reports~as when the checkpoint was written","ResumeCheckpoint",&sFilenameResume,"");
+
 }
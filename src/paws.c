@@ -46,8 +46,18 @@ void CreatePenClauseList() {
 }
 
 void InitPenClauseList() {
+  UINT32 j;
   iNumPenClauseList = 0;
   iPawsSmoothCounter = 0;
+
+  /* clause penalties are normally all 1 here, but not when resuming from a checkpoint */
+
+  for (j=0;j<iNumClauses;j++) {
+    if (aClausePenaltyINT[j] > 1) {
+      aPenClauseList[iNumPenClauseList] = j;
+      aPenClauseListPos[j] = iNumPenClauseList++;
+    }
+  }
 }
 
 
@@ -171,6 +181,7 @@ void SmoothPAWS() {
     /* decrease the clause penalty by one */
 
     aClausePenaltyINT[iClause]--;
+    PenaltyStatsChange(iClause);
 
     /* if clause penalty is equal to one, remove it from the list of penalized clauses. */
     
@@ -218,6 +229,7 @@ void ScalePAWS() {
     iClause = aFalseList[j];
 
     aClausePenaltyINT[iClause]++;
+    PenaltyStatsChange(iClause);
 
     if (aClausePenaltyINT[iClause]==2) {
 
@@ -56,6 +56,9 @@ REPORT *pRepMobFixedFreq;
 REPORT *pRepAutoCorr;
 REPORT *pRepTriggers;
 REPORT *pRepSATComp;
+REPORT *pRepAnytime;
+REPORT *pRepBatch;
+REPORT *pRepRTDEst;
 
 void AddReports() {
 
@@ -71,6 +74,9 @@ void AddReports() {
   pRepRTD = CreateReport("rtd","Run-Length and Run-Time Distribution","Similar to (-r out), except results are sorted by search steps,~and include successful runs~you can customize the report to include a variety of columns", "stdout","ReportRTD,SortByStepPerformance");
   AddReportParmString(pRepRTD,"Columns to Display (ubcsat -hc for info)","rtd");
 
+  pRepRTDEst = CreateReport("rtdest","Run-Length Distribution Estimate","Kaplan-Meier estimate of the run-length distribution~(unsuccessful runs are censored at the step they stopped)~prints the success probability and the median steps and time, with 95 percent bounds~and the relative error of the estimate (see -rtdprecision)","stdout","ReportRTDEstPrint");
+  AddReportParmUInt(pRepRTDEst,"Print the estimated distribution (with bounds) at each successful step",&bReportRTDEstCurve,0);
+
   pRepModel = CreateReport("model","Solution Model","Prints the solution model found from the last run executed~is turned on automatically with the -solve parameter~output format example is: -1 2 3 -4 ... ~meaning variables (1,4) are true, and variables (2,3) are false","stdout","ReportModelPrint");
 
   pRepCNFStats = CreateReport("cnfstats","Instance Statistics","Provides additional information about the properties of the instance","stdout","ReportCNFStatsPrint");
@@ -151,6 +157,13 @@ void AddReports() {
 
   pRepSATComp = CreateReport("satcomp","SAT Competition","Prints required output for 2005 SAT Competition (use -solve)","stdout","ReportSatCompetitionPrint");
 
+  pRepAnytime = CreateReport("anytime","Anytime MAX-SAT Output","Prints a MAX-SAT evaluation style line: o <cost>~every time the best solution quality over all runs improves~(cost is the # of false clauses, or the sum of false weights with -w)~o lines are rate-limited so frequent improvements do not stall the search~on SIGTERM the current run stops and the best model is printed","stdout","ReportAnytime");
+  AddReportParmUInt(pRepAnytime,"Print model (v lines): 0=never 1=at end 2=with every o line",&iReportAnytimeModel,1);
+  AddReportParmFloat(pRepAnytime,"Minimum seconds between o lines [default = 0.1]",&fReportAnytimeInterval,0.1f);
+
+  pRepBatch = CreateReport("batch","Batch Results","Prints one row for each instance solved in batch mode (-instlist):~the instance file name, the # of runs, the # of successful runs, the total time~and the mean (over the runs) of each column listed~is turned on automatically with the -instlist parameter","stdout","ReportBatch");
+  AddReportParmString(pRepBatch,"Columns to average over the runs (ubcsat -hc for info)","found,best,steps");
+
   /***************************************************************************/
 
   AddColumnComposite("default","run,found,best,beststep,steps");
@@ -840,7 +853,13 @@ void AddReports() {
   
   AddStatCustom("totaltime","Total Time Elapsed","TotalCPUTimeElapsed","%-10.3f",(void *)&fTotalTime,DTypeFloat,"","");
 
-  AddStatCustom("fps","Flips Per Second","FlipsPerSecond","%-7.f",(void *)&fFlipsPerSecond,DTypeFloat,"","CalcFPS");
+  AddStatCustom("fps","Flips Per Second","FlipsPerSecond","%-7.f",(void *)&fFlipsPerSecond,DTypeFloat,"steps","CalcFPS");
+
+  AddStatCustom("readtime","Time Elapsed Reading Instance","ReadCPUTime","%-10.3f",(void *)&fReadTime,DTypeFloat,"","");
+
+  AddStatCustom("firstflip","Wall Clock Time to First Flip","FirstFlipTime","%-10.3f",(void *)&fFirstFlipTime,DTypeFloat,"","CalcFirstFlipTime");
+
+  AddStatCustom("peakrss","Peak Resident Memory (KB)","PeakResidentKB","%u",(void *)&iPeakRSS,DTypeUInt,"","CalcPeakRSS");
 
   AddStatCustom("numunique","Number of Unique Solutions Found","UniqueSolutions","%u",(void *)&iNumUniqueSolutions,DTypeUInt,"","UniqueSolutions");
 
@@ -56,4 +56,7 @@ extern REPORT *pRepMobFixedFreq;
 extern REPORT *pRepAutoCorr;
 extern REPORT *pRepTriggers;
 extern REPORT *pRepSATComp;
+extern REPORT *pRepAnytime;
+extern REPORT *pRepBatch;
+extern REPORT *pRepRTDEst;
 
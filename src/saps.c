@@ -196,6 +196,8 @@ void SmoothSAPS() {
     
   fTotalPenaltyFL += (fAveragePenalty * (FLOAT) iNumClauses);
 
+  PenaltyStatsChangeAll();
+
   for (j=1;j<=iNumVars;j++) {
     aMakePenaltyFL[j] += fAveragePenalty * (FLOAT) aMakeCount[j];
     aBreakPenaltyFL[j] += fAveragePenalty * (FLOAT) aBreakCount[j];
@@ -248,6 +250,8 @@ void AdjustPenalties() {
 
       fTotalPenaltyFL += aClausePenaltyFL[j];
     }
+
+    PenaltyStatsChangeAll();
   }
 
 }
@@ -269,6 +273,7 @@ void ScaleSAPS() {
     fOld = aClausePenaltyFL[iClause];
 
     aClausePenaltyFL[iClause] *= fAlpha;
+    PenaltyStatsChange(iClause);
 
     fDiff = aClausePenaltyFL[iClause] - fOld;
 
@@ -339,6 +344,7 @@ void SmoothSAPSWSmooth() {
     fTotalPenaltyFL += aClausePenaltyFL[j];
   }
 
+  PenaltyStatsChangeAll();
 }
 
 void PostFlipSAPSWSmooth() {
@@ -0,0 +1,204 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+
+#include "ubcsat.h"
+
+/*
+    Batch mode (-instlist FILE)
+
+    Each instance in the list is solved in turn by the same process:
+    the algorithms, parameters, reports and triggers are only set up once,
+    and everything from ReadInInstance to FinalReports is repeated for each
+    instance (see ubcsatmain).
+
+    The RAM allocated for an instance is released (but not freed) before
+    the next instance is read, so the heaps of ubcsat-mem.c are reused.
+    The parameters are restored to their values after PostParameters
+    (some are set from the size of the instance) and the random seed is
+    set to -seed again, so each instance is solved exactly as if it had
+    been the only one.
+
+    The out and stats reports are replaced by the batch report,
+    which prints a row when each instance is done.
+*/
+
+char *sFilenameInstList;
+BOOL bBatchMode;
+UINT32 iNumInstances;
+
+FILE *filInstList;
+char sBatchInstance[MAXCNFLINELEN];
+
+PARAMETERDEFAULT aBatchParmsUBCSAT[MAXALGPARMS];
+PARAMETERDEFAULT aBatchParmsAlg[MAXALGPARMS];
+
+void SetupBatch() {
+
+  bBatchMode = TRUE;
+
+  if (*sFilenameIn) {
+    ReportPrint(pRepErr,"Error: -inst cannot be used with -instlist\n");
+    AbnormalExit();
+  }
+  if ((iFarmWorkers > 0) || (*sFarmCoordinator) || (*sFarmWorker) || (iCoopWorkers > 1)) {
+    ReportPrint(pRepErr,"Error: -instlist cannot be used with a run farm or -coop\n");
+    AbnormalExit();
+  }
+  if ((*sFilenameCheckpoint) || (*sFilenameResume) || (*sFilenameRandomData)) {
+    ReportPrint(pRepErr,"Error: -instlist cannot be used with -checkpoint, -resume or -filerand\n");
+    AbnormalExit();
+  }
+
+  if (strcmp(sFilenameInstList,"-")==0) {
+    filInstList = stdin;
+  } else {
+    SetupFile(&filInstList,"r",sFilenameInstList,stdin,0);
+  }
+
+  if (strcmp(pRepBatch->sOutputFile,"null")) {
+    pRepBatch->bActive = TRUE;
+  }
+}
+
+void SaveBatchParms(ALGPARMLIST *pParmList, PARAMETERDEFAULT *aValues) {
+
+  UINT32 j;
+  ALGPARM *pParm;
+
+  for (j=0;j<pParmList->iNumParms;j++) {
+    pParm = &pParmList->aParms[j];
+    switch (pParm->eType) {
+      case PTypeUInt:
+        aValues[j].iUInt = *(UINT32 *) pParm->pParmValue;
+        break;
+      case PTypeSInt:
+        aValues[j].iSInt = *(SINT32 *) pParm->pParmValue;
+        break;
+      case PTypeBool:
+        aValues[j].bBool = *(BOOL *) pParm->pParmValue;
+        break;
+      case PTypeString:
+        aValues[j].sString = *(char **) pParm->pParmValue;
+        break;
+      case PTypeProbability:
+        aValues[j].iProb = *(PROBABILITY *) pParm->pParmValue;
+        break;
+      case PTypeFloat:
+        aValues[j].fFloat = *(FLOAT *) pParm->pParmValue;
+        break;
+      case PTypeReport:
+        break;
+    }
+  }
+}
+
+void RestoreBatchParms(ALGPARMLIST *pParmList, PARAMETERDEFAULT *aValues) {
+
+  UINT32 j;
+  ALGPARM *pParm;
+
+  for (j=0;j<pParmList->iNumParms;j++) {
+    pParm = &pParmList->aParms[j];
+    switch (pParm->eType) {
+      case PTypeUInt:
+        *(UINT32 *) pParm->pParmValue = aValues[j].iUInt;
+        break;
+      case PTypeSInt:
+        *(SINT32 *) pParm->pParmValue = aValues[j].iSInt;
+        break;
+      case PTypeBool:
+        *(BOOL *) pParm->pParmValue = aValues[j].bBool;
+        break;
+      case PTypeString:
+        *(char **) pParm->pParmValue = aValues[j].sString;
+        break;
+      case PTypeProbability:
+        *(PROBABILITY *) pParm->pParmValue = aValues[j].iProb;
+        break;
+      case PTypeFloat:
+        *(FLOAT *) pParm->pParmValue = aValues[j].fFloat;
+        break;
+      case PTypeReport:
+        break;
+    }
+  }
+}
+
+BOOL NextInstance() {
+
+  char *pStart;
+  char *pEnd;
+
+  if (!bBatchMode) {
+    return(iNumInstances++ == 0);
+  }
+
+  if (iNumInstances == 0) {
+    SaveBatchParms(&parmUBCSAT,aBatchParmsUBCSAT);
+    SaveBatchParms(&pActiveAlgorithm->parmList,aBatchParmsAlg);
+    MarkRAM();
+  } else {
+    if (bSignalCaught) {
+      return(FALSE);
+    }
+    ReleaseRAM();
+    ResetReportData();
+    ResetDynamicParms();
+    RestoreBatchParms(&parmUBCSAT,aBatchParmsUBCSAT);
+    RestoreBatchParms(&pActiveAlgorithm->parmList,aBatchParmsAlg);
+    RandomSeed(iSeed);
+  }
+
+  if (bServeMode) {
+    if (ServeAccept()) {
+      iNumInstances++;
+      return(TRUE);
+    }
+    return(FALSE);
+  }
+
+  while (fgets(sBatchInstance,MAXCNFLINELEN,filInstList)) {
+
+    /* (blank lines and lines that start with # are skipped) */
+
+    pStart = sBatchInstance;
+    while ((*pStart == ' ') || (*pStart == '\t')) {
+      pStart++;
+    }
+    pEnd = pStart + strlen(pStart);
+    while ((pEnd > pStart) && ((pEnd[-1] == '\n') || (pEnd[-1] == '\r') || (pEnd[-1] == ' ') || (pEnd[-1] == '\t'))) {
+      pEnd--;
+    }
+    *pEnd = 0;
+
+    if ((*pStart) && (*pStart != '#')) {
+      sFilenameIn = pStart;
+      iNumInstances++;
+      return(TRUE);
+    }
+  }
+
+  CloseSingleFile(filInstList);
+  return(FALSE);
+}
+
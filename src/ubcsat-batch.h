@@ -0,0 +1,38 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+
+/*
+    Batch mode (-instlist FILE)
+
+    sFilenameInstList     file with the instance file names, one per line ("-" for stdin)
+    bBatchMode            more than one instance is solved by this process
+    iNumInstances         number of instances started so far
+*/
+
+extern char *sFilenameInstList;
+extern BOOL bBatchMode;
+extern UINT32 iNumInstances;
+
+void SetupBatch();
+BOOL NextInstance();
+
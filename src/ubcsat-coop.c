@@ -0,0 +1,443 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+#include "ubcsat.h"
+
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/*
+    Cooperative search (-coop N)
+
+    all of the state of a search is global, so the cooperating searches are
+    processes: at the start, N-1 copies of this process are forked (each
+    with its own seed) and they search the same instance.  Every
+    iCoopInterval steps, each process publishes its best assignment of the
+    run (vsBest) and its clause penalties to its own slot of a shared
+    memory buffer, and reads the slots of the others.
+
+    each slot has a sequence number that is odd while the slot is being
+    written, so no locks are needed: a reader copies the slot and discards
+    the copy if the sequence number was odd or has changed.
+
+    if another process has a better assignment (in the same run) the search
+    continues from that assignment or (with probability -coopcross) from a
+    uniform crossover of it and its own best assignment.  The clause
+    penalties of the others (scaled to the same total) are blended in with
+    weight -coopblend, for the algorithms that have clause penalties.
+
+    only the original process reports: the runs of the other processes end
+    when the original process starts a new run, and they exit when it
+    is done
+*/
+
+UINT32 iCoopWorkers;
+UINT32 iCoopInterval;
+FLOAT fCoopBlend;
+PROBABILITY iCoopCross;
+UINT32 iCoopWorker;
+
+#ifndef WIN32
+
+typedef struct typeCOOPHEADER {
+  UINT32 iRun;
+  UINT32 bDone;
+} COOPHEADER;
+
+typedef struct typeCOOPSLOT {
+  UINT32 iSeq;
+  UINT32 iRun;
+  FLOAT fBest;
+  FLOAT fTotalPenalty;
+} COOPSLOT;
+
+BYTE *pCoopShared;
+COOPHEADER *pCoopHeader;
+COOPSLOT *aCoopSlots;
+UINT32 iCoopStateLen;
+UINT32 iCoopSlotLen;
+
+pid_t aCoopPid[MAXCOOPWORKERS];
+pid_t iCoopParent;
+UINT32 iCoopRun;
+
+VARSTATE vsCoopElite;
+VARSTATE vsCoopCand;
+UINT32 *aCoopTarget;
+UINT32 *aCoopOwn;
+FLOAT *aCoopPenalty;
+FLOAT *aCoopPeerPenalty;
+FLOAT *aCoopPeerSum;
+
+BYTE *CoopSlotState(UINT32 iWorker) {
+  return(pCoopShared + sizeof(COOPHEADER) + iCoopWorkers * sizeof(COOPSLOT) + iWorker * iCoopSlotLen);
+}
+
+FLOAT *CoopSlotPenalty(UINT32 iWorker) {
+  return((FLOAT *) (CoopSlotState(iWorker) + iCoopStateLen));
+}
+
+FLOAT CoopBest() {
+  if (bWeighted) {
+    return(fBestSumFalseW);
+  } else {
+    return((FLOAT) iBestNumFalse);
+  }
+}
+
+void SetupCoopWorker() {
+
+  RandomSeed(iSeed + iCoopWorker);
+
+  iNumRuns = (UINT32) -1;
+  bParFlip = FALSE;
+
+  QuietReports();
+}
+
+#endif
+
+void StartCoop() {
+#ifndef WIN32
+  UINT32 j;
+  pid_t iPid;
+  size_t iSize;
+
+  if (iCoopWorkers < 2) {
+    return;
+  }
+
+  if (iCoopWorkers > MAXCOOPWORKERS) {
+    ReportPrint1(pRepErr,"Error: -coop is limited to %d processes\n",MAXCOOPWORKERS);
+    AbnormalExit();
+  }
+
+  if (iCoopInterval == 0) {
+    ReportPrint(pRepErr,"Error: -coopint must be at least 1\n");
+    AbnormalExit();
+  }
+
+  iCoopStateLen = (iVARSTATELen + sizeof(FLOAT) - 1) / sizeof(FLOAT) * sizeof(FLOAT);
+  iCoopSlotLen = iCoopStateLen;
+  if (bClausePenaltyCreated) {
+    iCoopSlotLen += iNumClauses * sizeof(FLOAT);
+  }
+
+  iSize = sizeof(COOPHEADER) + iCoopWorkers * (sizeof(COOPSLOT) + iCoopSlotLen);
+
+  pCoopShared = mmap(NULL,iSize,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_ANONYMOUS,-1,0);
+  if (pCoopShared == MAP_FAILED) {
+    pCoopShared = NULL;
+    ReportPrint(pRepErr,"Error: could not create the shared memory for -coop\n");
+    AbnormalExit();
+  }
+  memset(pCoopShared,0,iSize);
+
+  pCoopHeader = (COOPHEADER *) pCoopShared;
+  aCoopSlots = (COOPSLOT *) (pCoopShared + sizeof(COOPHEADER));
+
+  vsCoopElite = NewVarState();
+  vsCoopCand = NewVarState();
+  aCoopTarget = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aCoopOwn = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  if (bClausePenaltyCreated) {
+    aCoopPenalty = AllocateRAM(iNumClauses * sizeof(FLOAT));
+    aCoopPeerPenalty = AllocateRAM(iNumClauses * sizeof(FLOAT));
+    aCoopPeerSum = AllocateRAM(iNumClauses * sizeof(FLOAT));
+  }
+
+  iCoopParent = getpid();
+
+  /* anything buffered now would be written by every process */
+
+  RFFlush();
+  fflush(NULL);
+
+  for (j=1;j<iCoopWorkers;j++) {
+    iPid = fork();
+    if (iPid == 0) {
+      iCoopWorker = j;
+      SetupCoopWorker();
+      return;
+    }
+    if (iPid < 0) {
+      ReportPrint1(pRepErr,"Warning: only %u cooperating processes could be started\n",j);
+      break;
+    }
+    aCoopPid[j] = iPid;
+  }
+#else
+  if (iCoopWorkers > 1) {
+    ReportPrint(pRepErr,"Error: -coop is not supported on this platform\n");
+    AbnormalExit();
+  }
+#endif
+}
+
+void InitCoopRun() {
+#ifndef WIN32
+  if (pCoopShared == NULL) {
+    return;
+  }
+  if (iCoopWorker == 0) {
+    iCoopRun = iRun;
+    __atomic_store_n(&pCoopHeader->iRun,iRun,__ATOMIC_RELEASE);
+  } else {
+
+    /* (the terminal sends its signals to every process, only the original process handles them) */
+
+    signal(SIGINT,SIG_IGN);
+    signal(SIGTERM,SIG_IGN);
+#ifdef SIGUSR1
+    signal(SIGUSR1,SIG_IGN);
+#endif
+    iCoopRun = __atomic_load_n(&pCoopHeader->iRun,__ATOMIC_ACQUIRE);
+  }
+#endif
+}
+
+#ifndef WIN32
+
+void CoopPublish() {
+  COOPSLOT *pSlot;
+  FLOAT *aPen;
+  FLOAT fTotal;
+  UINT32 iSeq;
+  UINT32 j;
+
+  pSlot = &aCoopSlots[iCoopWorker];
+  iSeq = pSlot->iSeq;
+
+  __atomic_store_n(&pSlot->iSeq,iSeq + 1,__ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  pSlot->iRun = iCoopRun;
+  pSlot->fBest = CoopBest();
+  MaterializeSaveBest();
+  memcpy(CoopSlotState(iCoopWorker),vsBest,iVARSTATELen);
+
+  fTotal = 0.0;
+  if (bClausePenaltyCreated) {
+    aPen = CoopSlotPenalty(iCoopWorker);
+    for (j=0;j<iNumClauses;j++) {
+      if (bClausePenaltyFLOAT) {
+        aPen[j] = aClausePenaltyFL[j];
+      } else {
+        aPen[j] = (FLOAT) aClausePenaltyINT[j];
+      }
+      fTotal += aPen[j];
+    }
+  }
+  pSlot->fTotalPenalty = fTotal;
+
+  __atomic_store_n(&pSlot->iSeq,iSeq + 2,__ATOMIC_RELEASE);
+}
+
+void CoopSetPenalties(UINT32 iNumPeers) {
+  FLOAT fOwnTotal;
+  FLOAT fPen;
+  UINT32 j;
+
+  fOwnTotal = 0.0;
+  for (j=0;j<iNumClauses;j++) {
+    fOwnTotal += aCoopPenalty[j];
+  }
+
+  if (bClausePenaltyFLOAT) {
+    fTotalPenaltyFL = 0.0;
+    for (j=0;j<iNumClauses;j++) {
+      fPen = aCoopPenalty[j];
+      if (iNumPeers) {
+        fPen = (1.0 - fCoopBlend) * fPen + fCoopBlend * fOwnTotal * aCoopPeerSum[j] / (FLOAT) iNumPeers;
+      }
+      aClausePenaltyFL[j] = fPen;
+      fTotalPenaltyFL += fPen;
+    }
+    RunTriggerIfActive("InitMakeBreakPenaltyFL");
+  } else {
+    iTotalPenaltyINT = 0;
+    for (j=0;j<iNumClauses;j++) {
+      fPen = aCoopPenalty[j];
+      if (iNumPeers) {
+        fPen = (1.0 - fCoopBlend) * fPen + fCoopBlend * fOwnTotal * aCoopPeerSum[j] / (FLOAT) iNumPeers;
+      }
+
+      /* (ddfw needs satisfied clauses with at least the initial weight) */
+
+      if (fPen < (FLOAT) iBasePenaltyINT) {
+        aClausePenaltyINT[j] = iBasePenaltyINT;
+      } else {
+        aClausePenaltyINT[j] = (UINT32) (fPen + 0.5);
+      }
+      iTotalPenaltyINT += aClausePenaltyINT[j];
+    }
+    RunTriggerIfActive("InitMakeBreakPenaltyINT");
+    RunTriggerIfActive("InitPenClauseList");
+  }
+  PenaltyStatsChangeAll();
+}
+
+void CoopExchange() {
+  COOPSLOT *pSlot;
+  VARSTATE vsSwap;
+  FLOAT fElite;
+  FLOAT fBest;
+  FLOAT fTotal;
+  FLOAT fBasePenalty = 0.0;
+  UINT32 iBasePenalty = 0;
+  UINT32 iNumPeers;
+  UINT32 iSeq;
+  UINT32 j,k;
+  BOOL bElite;
+  BOOL bHaveElite;
+
+  fElite = CoopBest();
+  bHaveElite = FALSE;
+  iNumPeers = 0;
+
+  if (bClausePenaltyCreated) {
+    memset(aCoopPeerSum,0,iNumClauses * sizeof(FLOAT));
+  }
+
+  for (k=0;k<iCoopWorkers;k++) {
+    if (k == iCoopWorker) {
+      continue;
+    }
+    pSlot = &aCoopSlots[k];
+    iSeq = __atomic_load_n(&pSlot->iSeq,__ATOMIC_ACQUIRE);
+    if ((iSeq == 0) || (iSeq & 1) || (pSlot->iRun != iCoopRun)) {
+      continue;
+    }
+    fBest = pSlot->fBest;
+    fTotal = pSlot->fTotalPenalty;
+    bElite = (fBest < fElite);
+    if (bElite) {
+      memcpy(vsCoopCand,CoopSlotState(k),iVARSTATELen);
+    }
+    if (bClausePenaltyCreated) {
+      memcpy(aCoopPeerPenalty,CoopSlotPenalty(k),iNumClauses * sizeof(FLOAT));
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&pSlot->iSeq,__ATOMIC_RELAXED) != iSeq) {
+      continue;
+    }
+    if (bElite) {
+      vsSwap = vsCoopElite;
+      vsCoopElite = vsCoopCand;
+      vsCoopCand = vsSwap;
+      fElite = fBest;
+      bHaveElite = TRUE;
+    }
+    if ((bClausePenaltyCreated) && (fTotal > 0.0)) {
+      for (j=0;j<iNumClauses;j++) {
+        aCoopPeerSum[j] += aCoopPeerPenalty[j] / fTotal;
+      }
+      iNumPeers++;
+    }
+  }
+
+  if ((!bHaveElite) && (iNumPeers == 0)) {
+    return;
+  }
+
+  if (bClausePenaltyCreated) {
+    for (j=0;j<iNumClauses;j++) {
+      if (bClausePenaltyFLOAT) {
+        aCoopPenalty[j] = aClausePenaltyFL[j];
+      } else {
+        aCoopPenalty[j] = (FLOAT) aClausePenaltyINT[j];
+      }
+    }
+    fBasePenalty = fBasePenaltyFL;
+    iBasePenalty = iBasePenaltyINT;
+  }
+
+  if (bHaveElite) {
+    SetArrayFromVarState(aCoopTarget,vsCoopElite);
+    if ((fElite > 0.0) && (iBestNumFalse <= iNumClauses) && (RandomProb(iCoopCross))) {
+      MaterializeSaveBest();
+      SetArrayFromVarState(aCoopOwn,vsBest);
+      for (j=1;j<=iNumVars;j++) {
+        if (RandomInt(2)) {
+          aCoopTarget[j] = aCoopOwn[j];
+        }
+      }
+    }
+
+    /* rebuild all of the state information from the new assignment (as when resuming a checkpoint) */
+
+    memcpy(aVarValue,aCoopTarget,(iNumVars+1) * sizeof(UINT32));
+    RunProcedures2(InitStateInfo);
+
+    fBasePenaltyFL = fBasePenalty;
+    iBasePenaltyINT = iBasePenalty;
+  }
+
+  if (bClausePenaltyCreated) {
+    CoopSetPenalties(iNumPeers);
+  }
+}
+
+#endif
+
+void UpdateCoop() {
+#ifndef WIN32
+  if ((pCoopShared == NULL) || (iStep % iCoopInterval)) {
+    return;
+  }
+  if (iCoopWorker) {
+    if ((__atomic_load_n(&pCoopHeader->bDone,__ATOMIC_ACQUIRE)) || (getppid() != iCoopParent)) {
+      _exit(0);
+    }
+    if (__atomic_load_n(&pCoopHeader->iRun,__ATOMIC_ACQUIRE) != iCoopRun) {
+      bTerminateRun = TRUE;
+      return;
+    }
+  }
+  CoopPublish();
+  CoopExchange();
+#endif
+}
+
+void StopCoop() {
+#ifndef WIN32
+  UINT32 j;
+
+  if (pCoopShared == NULL) {
+    return;
+  }
+  if (iCoopWorker) {
+    _exit(0);
+  }
+  __atomic_store_n(&pCoopHeader->bDone,TRUE,__ATOMIC_RELEASE);
+  for (j=1;j<iCoopWorkers;j++) {
+    if (aCoopPid[j] > 0) {
+      waitpid(aCoopPid[j],NULL,0);
+    }
+  }
+#endif
+}
+
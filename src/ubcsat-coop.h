@@ -0,0 +1,43 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+/*
+    Cooperative search (-coop N)
+
+    iCoopWorkers      number of cooperating search processes (including this one)
+    iCoopInterval     number of steps between exchanges
+    fCoopBlend        weight of the (normalized) shared clause penalties
+    iCoopCross        probability of a crossover (instead of a copy) of an elite
+    iCoopWorker       0 for the original process, 1..(iCoopWorkers-1) otherwise
+*/
+
+extern UINT32 iCoopWorkers;
+extern UINT32 iCoopInterval;
+extern FLOAT fCoopBlend;
+extern PROBABILITY iCoopCross;
+extern UINT32 iCoopWorker;
+
+void StartCoop();
+void InitCoopRun();
+void UpdateCoop();
+void StopCoop();
+
@@ -0,0 +1,623 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+#include "ubcsat.h"
+
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+/*
+    Run farm (-workers N, -coordinator PATH, -worker PATH)
+
+    the coordinator does not search: it hands out run numbers & seeds to
+    the workers and collects the row of column values (see REPORTCOL) of
+    each run.  The coordinator still goes through every run in order, but
+    at the start of each run (FarmRun) it waits for the row of that run,
+    loads it (with the solution, if one was found) and skips the search,
+    so the out, stats and rtd reports, -find and -findunique behave as if
+    the runs had been serial.
+
+    workers are either forked by the coordinator (-workers N), or started
+    separately with -worker PATH (with the same instance & parameters) and
+    connect to the Unix socket of a -coordinator PATH.  A run that was
+    given to a worker that exits is given to another worker.
+
+    run 1 has the seed (-seed), and the seeds of the other runs are drawn
+    by the coordinator at the start (the seed column shows the seed of
+    each run, and a run can be repeated with -seed).  Only the column
+    values and the solutions are collected: the reports that are printed
+    from the state of the search after each run (other than solution &
+    unique solutions) are not supported
+*/
+
+UINT32 iFarmWorkers;
+char *sFarmCoordinator;
+char *sFarmWorker;
+
+BOOL bFarmCoordinator;
+BOOL bFarmWorker;
+
+#ifndef WIN32
+
+#define FARMHELLO   1
+#define FARMRUN     2
+#define FARMRESULT  3
+#define FARMSTOP    4
+
+typedef struct typeFARMMSG {
+  UINT32 iType;
+  UINT32 iRun;
+  UINT32 iSeed;
+  UINT32 iLen;
+} FARMMSG;
+
+typedef struct typeFARMHELLO {
+  UINT32 iNumVars;
+  UINT32 iNumClauses;
+  UINT32 iNumColumns;
+  UINT32 iNumRuns;
+} FARMHELLOINFO;
+
+typedef struct typeFARMROW {
+  UINT32 bSolutionFound;
+  UINT32 iStep;
+  FLOAT fRunTime;
+} FARMROW;
+
+typedef struct typeFARMCOLVALUE {
+  UINT32 uiValue;
+  SINT32 siValue;
+  FLOAT fValue;
+} FARMCOLVALUE;
+
+typedef struct typeFARMWORKER {
+  int iSocket;
+  pid_t iPid;
+  UINT32 iRun;
+  BOOL bReady;
+} FARMWORKER;
+
+FARMWORKER aFarmWorkers[MAXFARMWORKERS];
+UINT32 iNumFarmWorkers;
+int iFarmListen = -1;
+int iFarmSocket = -1;
+
+UINT32 iNumFarmColumns;
+UINT32 iFarmRowLen;
+BYTE *pFarmRow;
+VARSTATE vsFarmSolution;
+
+BYTE **aFarmRows;
+UINT32 *aFarmSeeds;
+UINT32 *aFarmRequeue;
+UINT32 iNumFarmRequeue;
+UINT32 iFarmNextRun;
+FLOAT fFarmTotalTime;
+
+BOOL FarmWrite(int iSocket, const void *pData, size_t iLen) {
+  const BYTE *pCur = (const BYTE *) pData;
+  ssize_t iDone;
+  while (iLen) {
+    iDone = write(iSocket,pCur,iLen);
+    if (iDone < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return(FALSE);
+    }
+    pCur += iDone;
+    iLen -= iDone;
+  }
+  return(TRUE);
+}
+
+BOOL FarmRead(int iSocket, void *pData, size_t iLen) {
+  BYTE *pCur = (BYTE *) pData;
+  ssize_t iDone;
+  while (iLen) {
+    iDone = read(iSocket,pCur,iLen);
+    if (iDone < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return(FALSE);
+    }
+    if (iDone == 0) {
+      return(FALSE);
+    }
+    pCur += iDone;
+    iLen -= iDone;
+  }
+  return(TRUE);
+}
+
+BOOL FarmSend(int iSocket, UINT32 iType, UINT32 iRun, UINT32 iSeed, const void *pData, UINT32 iLen) {
+  FARMMSG msg;
+  msg.iType = iType;
+  msg.iRun = iRun;
+  msg.iSeed = iSeed;
+  msg.iLen = iLen;
+  if (!FarmWrite(iSocket,&msg,sizeof(FARMMSG))) {
+    return(FALSE);
+  }
+  return((iLen == 0) || (FarmWrite(iSocket,pData,iLen)));
+}
+
+void FarmCountColumns() {
+  UINT32 j;
+  iNumFarmColumns = 0;
+  for (j=0;j<listColumns.iNumItems;j++) {
+    if (aColumns[j].bActive) {
+      iNumFarmColumns++;
+    }
+  }
+  iFarmRowLen = sizeof(FARMROW) + iNumFarmColumns * sizeof(FARMCOLVALUE);
+}
+
+void FarmHello() {
+  FARMHELLOINFO hello;
+
+  hello.iNumVars = iNumVars;
+  hello.iNumClauses = iNumClauses;
+  hello.iNumColumns = iNumFarmColumns;
+  hello.iNumRuns = iNumRuns;
+
+  /* the run numbers are given by the coordinator (and are at most -runs) */
+
+  iNumRuns = (UINT32) -1;
+
+  if (!FarmSend(iFarmSocket,FARMHELLO,0,0,&hello,sizeof(FARMHELLOINFO))) {
+    _exit(0);
+  }
+}
+
+void AddFarmWorker(int iSocket, pid_t iPid) {
+  FARMWORKER *pWorker;
+  if (iNumFarmWorkers == MAXFARMWORKERS) {
+    ReportPrint1(pRepErr,"Warning: the coordinator is limited to %d workers\n",MAXFARMWORKERS);
+    close(iSocket);
+    return;
+  }
+  pWorker = &aFarmWorkers[iNumFarmWorkers++];
+  pWorker->iSocket = iSocket;
+  pWorker->iPid = iPid;
+  pWorker->iRun = 0;
+  pWorker->bReady = FALSE;
+}
+
+void RemoveFarmWorker(UINT32 iWorker) {
+  FARMWORKER *pWorker = &aFarmWorkers[iWorker];
+
+  /* its run is given to the next worker that is ready */
+
+  if (pWorker->iRun) {
+    aFarmRequeue[iNumFarmRequeue++] = pWorker->iRun;
+  }
+  close(pWorker->iSocket);
+  if (pWorker->iPid > 0) {
+    waitpid(pWorker->iPid,NULL,0);
+  }
+  aFarmWorkers[iWorker] = aFarmWorkers[--iNumFarmWorkers];
+}
+
+void FarmDispatch() {
+  UINT32 j;
+  UINT32 iNext;
+
+  for (j=0;j<iNumFarmWorkers;j++) {
+    if ((!aFarmWorkers[j].bReady) || (aFarmWorkers[j].iRun)) {
+      continue;
+    }
+    if (iNumFarmRequeue) {
+      iNext = aFarmRequeue[--iNumFarmRequeue];
+    } else if (iFarmNextRun <= iNumRuns) {
+      iNext = iFarmNextRun++;
+    } else {
+      return;
+    }
+    aFarmWorkers[j].iRun = iNext;
+    if (!FarmSend(aFarmWorkers[j].iSocket,FARMRUN,iNext,aFarmSeeds[iNext-1],NULL,0)) {
+      aFarmWorkers[j].bReady = FALSE;
+    }
+  }
+}
+
+BOOL FarmReceive(UINT32 iWorker) {
+  FARMWORKER *pWorker = &aFarmWorkers[iWorker];
+  FARMMSG msg;
+  FARMHELLOINFO hello;
+  BYTE *pRow;
+
+  if (!FarmRead(pWorker->iSocket,&msg,sizeof(FARMMSG))) {
+    return(FALSE);
+  }
+
+  switch (msg.iType) {
+    case FARMHELLO:
+      if ((msg.iLen != sizeof(FARMHELLOINFO)) || (!FarmRead(pWorker->iSocket,&hello,sizeof(FARMHELLOINFO)))) {
+        return(FALSE);
+      }
+      if ((hello.iNumVars != iNumVars) || (hello.iNumClauses != iNumClauses) || (hello.iNumColumns != iNumFarmColumns) || (hello.iNumRuns != iNumRuns)) {
+        ReportPrint(pRepErr,"Warning: a worker was rejected (the instance, -runs and reports must be the same as the coordinator)\n");
+        return(FALSE);
+      }
+      pWorker->bReady = TRUE;
+      return(TRUE);
+
+    case FARMRESULT:
+      if ((msg.iRun != pWorker->iRun) || (msg.iLen < iFarmRowLen) || (msg.iLen > iFarmRowLen + iVARSTATELen)) {
+        return(FALSE);
+      }
+      pRow = malloc(msg.iLen);
+      if (pRow == NULL) {
+        ReportPrint(pRepErr,"Error: out of memory for the worker results\n");
+        AbnormalExit();
+      }
+      if (!FarmRead(pWorker->iSocket,pRow,msg.iLen)) {
+        free(pRow);
+        return(FALSE);
+      }
+      aFarmRows[msg.iRun-1] = pRow;
+      pWorker->iRun = 0;
+      return(TRUE);
+  }
+  return(FALSE);
+}
+
+void FarmWaitRow(UINT32 iWaitRun) {
+  struct pollfd aPoll[MAXFARMWORKERS + 1];
+  UINT32 iNumPoll;
+  UINT32 j;
+  int iSocket;
+
+  while (aFarmRows[iWaitRun-1] == NULL) {
+
+    FarmDispatch();
+
+    if ((iNumFarmWorkers == 0) && (iFarmListen < 0)) {
+      ReportPrint1(pRepErr,"Error: no workers remain for run [%u]\n",iWaitRun);
+      AbnormalExit();
+    }
+
+    for (j=0;j<iNumFarmWorkers;j++) {
+      aPoll[j].fd = aFarmWorkers[j].iSocket;
+      aPoll[j].events = POLLIN;
+      aPoll[j].revents = 0;
+    }
+    iNumPoll = iNumFarmWorkers;
+    if (iFarmListen >= 0) {
+      aPoll[iNumPoll].fd = iFarmListen;
+      aPoll[iNumPoll].events = POLLIN;
+      aPoll[iNumPoll].revents = 0;
+      iNumPoll++;
+    }
+
+    if (poll(aPoll,iNumPoll,-1) < 0) {
+      continue;
+    }
+
+    /* (in reverse, because removing a worker moves the last worker) */
+
+    for (j=iNumFarmWorkers;j>0;j--) {
+      if (aPoll[j-1].revents) {
+        if (!FarmReceive(j-1)) {
+          RemoveFarmWorker(j-1);
+        }
+      }
+    }
+
+    if ((iFarmListen >= 0) && (aPoll[iNumPoll-1].revents & POLLIN)) {
+      iSocket = accept(iFarmListen,NULL,NULL);
+      if (iSocket >= 0) {
+        AddFarmWorker(iSocket,0);
+      }
+    }
+  }
+}
+
+void FarmLoadRow(BYTE *pRow) {
+  FARMROW *pHead = (FARMROW *) pRow;
+  FARMCOLVALUE *pVal = (FARMCOLVALUE *) (pRow + sizeof(FARMROW));
+  REPORTCOL *pCol;
+  UINT32 j;
+
+  bSolutionFound = (BOOL) pHead->bSolutionFound;
+  iStep = pHead->iStep;
+  fRunTime = pHead->fRunTime;
+  fFarmTotalTime += fRunTime;
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    if (pCol->bActive) {
+      pCol->uiCurRowValue = pVal->uiValue;
+      pCol->siCurRowValue = pVal->siValue;
+      pCol->fCurRowValue = pVal->fValue;
+      pVal++;
+    }
+  }
+
+  if (bSolutionFound) {
+    memcpy(vsFarmSolution,pVal,iVARSTATELen);
+    SetArrayFromVarState(aVarValue,vsFarmSolution);
+  }
+}
+
+void FarmSetupForked() {
+  QuietReports();
+  signal(SIGINT,SIG_IGN);
+  signal(SIGTERM,SIG_IGN);
+#ifdef SIGUSR1
+  signal(SIGUSR1,SIG_IGN);
+#endif
+}
+
+#endif
+
+void SetupFarm() {
+#ifndef WIN32
+  bFarmCoordinator = ((iFarmWorkers > 0) || (*sFarmCoordinator));
+  bFarmWorker = (*sFarmWorker != 0);
+
+  if ((bFarmCoordinator) && (bFarmWorker)) {
+    ReportPrint(pRepErr,"Error: -worker cannot be used with -workers or -coordinator\n");
+    AbnormalExit();
+  }
+  if ((iCoopWorkers > 1) && ((bFarmCoordinator) || (bFarmWorker))) {
+    ReportPrint(pRepErr,"Error: -coop cannot be used with a run farm\n");
+    AbnormalExit();
+  }
+  if (iFarmWorkers > MAXFARMWORKERS) {
+    ReportPrint1(pRepErr,"Error: -workers is limited to %d\n",MAXFARMWORKERS);
+    AbnormalExit();
+  }
+  if (bFarmWorker) {
+    QuietReports();
+  }
+#else
+  if ((iFarmWorkers > 0) || (*sFarmCoordinator) || (*sFarmWorker)) {
+    ReportPrint(pRepErr,"Error: the run farm is not supported on this platform\n");
+    AbnormalExit();
+  }
+#endif
+}
+
+void StartFarm() {
+#ifndef WIN32
+  struct sockaddr_un addr;
+  int aPair[2];
+  pid_t iPid;
+  UINT32 j;
+
+  if ((!bFarmCoordinator) && (!bFarmWorker)) {
+    return;
+  }
+
+  /* (a worker or coordinator that has gone is noticed when reading) */
+
+  signal(SIGPIPE,SIG_IGN);
+
+  FarmCountColumns();
+  vsFarmSolution = NewVarState();
+  pFarmRow = AllocateRAM(iFarmRowLen + iVARSTATELen);
+
+  if (bFarmWorker) {
+    iFarmSocket = socket(AF_UNIX,SOCK_STREAM,0);
+    memset(&addr,0,sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path,sFarmWorker,sizeof(addr.sun_path) - 1);
+    if ((iFarmSocket < 0) || (connect(iFarmSocket,(struct sockaddr *) &addr,sizeof(addr)))) {
+      ReportPrint1(pRepErr,"Error: could not connect to the coordinator [%s]\n",sFarmWorker);
+      AbnormalExit();
+    }
+    FarmHello();
+    return;
+  }
+
+  aFarmRows = AllocateRAM(iNumRuns * sizeof(BYTE *));
+  memset(aFarmRows,0,iNumRuns * sizeof(BYTE *));
+  aFarmSeeds = AllocateRAM(iNumRuns * sizeof(UINT32));
+  aFarmSeeds[0] = iSeed;
+  for (j=1;j<iNumRuns;j++) {
+    aFarmSeeds[j] = RandomMax();
+  }
+  aFarmRequeue = AllocateRAM(iNumRuns * sizeof(UINT32));
+  iNumFarmRequeue = 0;
+  iFarmNextRun = 1;
+  fFarmTotalTime = FLOATZERO;
+
+  if (*sFarmCoordinator) {
+    iFarmListen = socket(AF_UNIX,SOCK_STREAM,0);
+    memset(&addr,0,sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path,sFarmCoordinator,sizeof(addr.sun_path) - 1);
+    unlink(sFarmCoordinator);
+    if ((iFarmListen < 0) || (bind(iFarmListen,(struct sockaddr *) &addr,sizeof(addr))) || (listen(iFarmListen,MAXFARMWORKERS))) {
+      ReportPrint1(pRepErr,"Error: could not listen on [%s]\n",sFarmCoordinator);
+      AbnormalExit();
+    }
+  }
+
+  /* anything buffered now would be written by every process */
+
+  RFFlush();
+  fflush(NULL);
+
+  for (j=0;j<iFarmWorkers;j++) {
+    if (socketpair(AF_UNIX,SOCK_STREAM,0,aPair)) {
+      ReportPrint(pRepErr,"Error: could not create a socket for a worker\n");
+      AbnormalExit();
+    }
+    iPid = fork();
+    if (iPid == 0) {
+      close(aPair[0]);
+      if (iFarmListen >= 0) {
+        close(iFarmListen);
+      }
+      for (;iNumFarmWorkers;iNumFarmWorkers--) {
+        close(aFarmWorkers[iNumFarmWorkers-1].iSocket);
+      }
+      bFarmCoordinator = FALSE;
+      bFarmWorker = TRUE;
+      iFarmSocket = aPair[1];
+      FarmSetupForked();
+      FarmHello();
+      return;
+    }
+    close(aPair[1]);
+    if (iPid < 0) {
+      close(aPair[0]);
+      ReportPrint1(pRepErr,"Warning: only %u workers could be started\n",j);
+      break;
+    }
+    AddFarmWorker(aPair[0],iPid);
+  }
+#endif
+}
+
+void FarmRun() {
+#ifndef WIN32
+  FARMMSG msg;
+
+  if (bFarmWorker) {
+    if ((!FarmRead(iFarmSocket,&msg,sizeof(FARMMSG))) || (msg.iType != FARMRUN)) {
+      _exit(0);
+    }
+    iRun = msg.iRun;
+    iStartSeed = msg.iSeed;
+    RandomSeed(msg.iSeed);
+  } else if (bFarmCoordinator) {
+    FarmWaitRow(iRun);
+    FarmLoadRow(aFarmRows[iRun-1]);
+    free(aFarmRows[iRun-1]);
+    aFarmRows[iRun-1] = NULL;
+    bTerminateRun = TRUE;
+  }
+#endif
+}
+
+void FarmStep() {
+#ifndef WIN32
+  struct pollfd pfd;
+
+  /* the coordinator only writes to a worker during a run to stop it */
+
+  if ((bFarmWorker) && ((iStep & FARMPOLLMASK) == 0)) {
+    pfd.fd = iFarmSocket;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd,1,0) > 0) {
+      _exit(0);
+    }
+  }
+#endif
+}
+
+void FarmResult() {
+#ifndef WIN32
+  FARMROW *pHead;
+  FARMCOLVALUE *pVal;
+  REPORTCOL *pCol;
+  UINT32 iLen;
+  UINT32 j;
+
+  if (!bFarmWorker) {
+    return;
+  }
+
+  pHead = (FARMROW *) pFarmRow;
+  pVal = (FARMCOLVALUE *) (pFarmRow + sizeof(FARMROW));
+
+  pHead->bSolutionFound = bSolutionFound;
+  pHead->iStep = iStep;
+  pHead->fRunTime = fRunTime;
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    if (pCol->bActive) {
+      pVal->uiValue = pCol->uiCurRowValue;
+      pVal->siValue = pCol->siCurRowValue;
+      pVal->fValue = pCol->fCurRowValue;
+      pVal++;
+    }
+  }
+
+  iLen = iFarmRowLen;
+  if (bSolutionFound) {
+    SetCurVarState(vsFarmSolution);
+    memcpy(pVal,vsFarmSolution,iVARSTATELen);
+    iLen += iVARSTATELen;
+  }
+
+  if (!FarmSend(iFarmSocket,FARMRESULT,iRun,0,pFarmRow,iLen)) {
+    _exit(0);
+  }
+#endif
+}
+
+void StopFarm() {
+#ifndef WIN32
+  UINT32 j;
+
+  if (bFarmWorker) {
+    _exit(0);
+  }
+  if (!bFarmCoordinator) {
+    return;
+  }
+
+  for (j=0;j<iNumFarmWorkers;j++) {
+    FarmSend(aFarmWorkers[j].iSocket,FARMSTOP,0,0,NULL,0);
+    close(aFarmWorkers[j].iSocket);
+  }
+  for (j=0;j<iNumFarmWorkers;j++) {
+    if (aFarmWorkers[j].iPid > 0) {
+      waitpid(aFarmWorkers[j].iPid,NULL,0);
+    }
+  }
+  iNumFarmWorkers = 0;
+
+  for (j=0;j<iNumRuns;j++) {
+    if (aFarmRows[j]) {
+      free(aFarmRows[j]);
+      aFarmRows[j] = NULL;
+    }
+  }
+
+  if (iFarmListen >= 0) {
+    close(iFarmListen);
+    unlink(sFarmCoordinator);
+    iFarmListen = -1;
+  }
+
+  /* the total time is the sum of the run times (as if the runs had been serial) */
+
+  fTotalTime = fFarmTotalTime;
+#endif
+}
+
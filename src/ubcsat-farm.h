@@ -0,0 +1,47 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+/*
+    Run farm (-workers N, -coordinator PATH, -worker PATH)
+
+    iFarmWorkers          number of worker processes forked by the coordinator
+    sFarmCoordinator      Unix socket the coordinator accepts (other) workers on
+    sFarmWorker           Unix socket of the coordinator (this process is a worker)
+
+    bFarmCoordinator      this process hands out the runs (and does not search)
+    bFarmWorker           this process searches the runs it is given
+*/
+
+extern UINT32 iFarmWorkers;
+extern char *sFarmCoordinator;
+extern char *sFarmWorker;
+
+extern BOOL bFarmCoordinator;
+extern BOOL bFarmWorker;
+
+void SetupFarm();
+void StartFarm();
+void FarmRun();
+void FarmStep();
+void FarmResult();
+void StopFarm();
+
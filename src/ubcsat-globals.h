@@ -47,8 +47,12 @@
     iPeriodicRestart      restart each run every iPeriodicRestart steps
     iProbRestart          restart with a probability
     iStagnateRestart      restart if no improvement in iStagnateRestart steps
+    sRestartPolicy        name of the restart policy (luby, geometric, adaptive)
+    iRestartBase          # of steps in the first (or unit) restart length of the policy (0 = # of variables)
+    fRestartFactor        growth of each restart length of the geometric policy
 
     bRestart              flag to restart the current run
+    bIncRestart           restarts flip the variables that change instead of re-initializing
 
     iRun                  current run number
     iStep                 current step number
@@ -96,15 +100,19 @@ extern UINT32 iFindUnique;
 extern UINT32 iPeriodicRestart;
 extern PROBABILITY iProbRestart;
 extern UINT32 iStagnateRestart;
+extern char *sRestartPolicy;
+extern UINT32 iRestartBase;
+extern FLOAT fRestartFactor;
 
 extern BOOL bRestart;
+extern BOOL bIncRestart;
 
 extern UINT32 iRun;
 extern UINT32 iStep;
 
-extern BOOL bTerminateAllRuns;
+extern volatile sig_atomic_t bTerminateAllRuns;
 extern BOOL bSolutionFound;
-extern BOOL bTerminateRun;
+extern volatile sig_atomic_t bTerminateRun;
 
 extern BOOL bSolveMode;
 
@@ -115,6 +123,7 @@ extern char *sFilenameVarInit;
 extern BOOL bReportEcho;
 extern BOOL bReportClean;
 extern BOOL bReportFlush;
+extern BOOL bReportStream;
 
 extern SINT32 iBestScore;
 extern FLOAT fBestScore;
@@ -157,6 +166,17 @@ void CreateTrigger(const char *sID,
                    char *sDependencyList,
                    char *sDeactivateList);
 
+/*
+    CreateSampledTrigger()  add a trigger that can be run only on the sample steps (-statsample)
+                            (only for the PostStep and StepCalculations event points)
+*/
+
+void CreateSampledTrigger(const char *sID,
+                   enum EVENTPOINT eEventPoint,
+                   FXNPTR pProcedure,
+                   char *sDependencyList,
+                   char *sDeactivateList);
+
 /*
     CreateContainerTrigger()    add a new container trigger to the UBCSAT system
 */
@@ -304,6 +324,7 @@ void AddStatCustom(const char *sID,
 
 /*
     IsLocalMinimum()      returns TRUE if currently in a local minimum
+                          (without a scan if the ImproveCount trigger is active)
 */
 
 BOOL IsLocalMinimum(BOOL bUseWeighted);
@@ -33,6 +33,8 @@
 const char *sValidStatCodes[NUMVALIDSTATCODES] = {"all","mean","stddev","cv","var","stderr","vmr","sum","median","min","max","q05","q10","q25","q75","q90","q95","q98","qr75/25","qr90/10","qr95/05","stepmean","solvemean","failmean","solvemedian","failmedian","solvemin","failmin","solvemax","failmax"};
 
 UINT32 aActiveCalcColumns[MAXITEMLIST];
+UINT32 aActiveMeanColumns[MAXITEMLIST];
+UINT32 aActiveMinMaxColumns[MAXITEMLIST];
 FXNPTR aActiveProcedures[NUMEVENTPOINTS][MAXFXNLIST];
 ALGORITHM aAlgorithms[MAXNUMALG];
 REPORTCOL aColumns[MAXITEMLIST];
@@ -41,18 +43,22 @@ UINT32 aNumActiveProcedures[NUMEVENTPOINTS];
 UINT32 aOutputColumns[MAXITEMLIST];
 REPORT aReports[MAXREPORTS];
 UINT32 aRTDColumns[MAXITEMLIST];
+FXNPTR aSampledProcedures[NUMEVENTPOINTS][MAXFXNLIST];
+UINT32 aNumSampledProcedures[NUMEVENTPOINTS];
 REPORTSTAT aStats[MAXITEMLIST];
 char **aTotalParms;
 TRIGGER aTriggers[MAXITEMLIST];
 BOOL aParmValid[MAXTOTALPARMS];
 BOOL bReportClean;
 BOOL bReportFlush;
+BOOL bReportStream;
 BOOL bReportEcho;
+BOOL bIncRestart;
 BOOL bRestart;
 BOOL bSolutionFound;
 BOOL bSolveMode;
-BOOL bTerminateAllRuns;
-BOOL bTerminateRun;
+volatile sig_atomic_t bTerminateAllRuns;
+volatile sig_atomic_t bTerminateRun;
 BOOL bWeighted;
 FLOAT fDummy;
 FLOAT fFlipsPerSecond;
@@ -64,6 +70,8 @@ UINT32 iFind;
 UINT32 iFindUnique;
 UINT32 iFlipCandidate;
 UINT32 iNumActiveCalcColumns;
+UINT32 iNumActiveMeanColumns;
+UINT32 iNumActiveMinMaxColumns;
 UINT32 iNumAlg;
 UINT32 iNumDynamicParms;
 UINT32 iNumOutputColumns;
@@ -80,6 +88,9 @@ UINT32 iRunProceduresLoop;
 UINT32 iRunProceduresLoop2;
 UINT32 iSeed;
 UINT32 iStagnateRestart;
+char *sRestartPolicy;
+UINT32 iRestartBase;
+FLOAT fRestartFactor;
 UINT32 iStep;
 UINT32 iTarget;
 FLOAT fTimeOut;
@@ -168,9 +179,15 @@ void ActivateColumnID(UINT32 iColID, const char *sItem) {
       case ColTypeMean:
       case ColTypeStddev:
       case ColTypeCV:
+        ActivateTriggers("ColumnStepMeanCalculation");
+        aActiveMeanColumns[iNumActiveMeanColumns++] = iColID;
+        aActiveCalcColumns[iNumActiveCalcColumns++] = iColID;
+        ActivateTriggers("ColumnRunCalculation");
+        break;
       case ColTypeMin:
       case ColTypeMax:
         ActivateTriggers("ColumnStepCalculation");
+        aActiveMinMaxColumns[iNumActiveMinMaxColumns++] = iColID;
         aActiveCalcColumns[iNumActiveCalcColumns++] = iColID;
       case ColTypeFinal:
       case ColTypeFinalDivStep:
@@ -208,17 +225,35 @@ void ActivateStatID(UINT32 iStatID, const char *sItem) {
       pStat->iStatFlags = SetColStatFlags(pStat->sStatParms);
       ActivateColumns(pStat->sDataColumn);
 
-      if (pStat->iStatFlags & STATCODE_RAMMASK) {
-        ParseItemList(&listColumns,pStat->sDataColumn,AddAllocateRAMColumnID);
-      }
+      if (bReportStream) {
+
+        /* the quantile sketch is ordered by value, which is the step
+           order only for the steps column itself */
+
+        if ((pStat->iStatFlags & STATCODE_SORTMASK) && (pStat->bSortByStep) && (strcmp(pStat->sDataColumn,"steps"))) {
+          ParseItemList(&listColumns,pStat->sDataColumn,AddAllocateRAMColumnID);
+          ActivateTriggers("SortByStepPerformance");
+        } else if (pStat->iStatFlags & STATCODE_RAMMASK) {
+          ParseItemList(&listColumns,pStat->sDataColumn,AddStreamColumnID);
+        }
+        if (pStat->iStatFlags & STATCODE_SFMASK) {
+          ParseItemList(&listColumns,pStat->sDataColumn,AddStreamSolveFailColumnID);
+        }
+      } else {
+        if (pStat->iStatFlags & STATCODE_RAMMASK) {
+          ParseItemList(&listColumns,pStat->sDataColumn,AddAllocateRAMColumnID);
+        }
 
-      if (pStat->iStatFlags & STATCODE_SFMASK) {
-        ActivateTriggers("SortByStepPerformance");
+        if ((pStat->iStatFlags & STATCODE_SFMASK) || ((pStat->iStatFlags & STATCODE_SORTMASK) && (pStat->bSortByStep))) {
+          ActivateTriggers("SortByStepPerformance");
+        }
       }
 
     } else {
       ActivateColumns(pStat->sDataColumn);
-      ParseItemList(&listColumns,pStat->sDataColumn,AddAllocateRAMColumnID);
+      if (!bReportStream) {
+        ParseItemList(&listColumns,pStat->sDataColumn,AddAllocateRAMColumnID);
+      }
       ActivateTriggers(pStat->sTriggers);
     }
   
@@ -307,6 +342,32 @@ void ActivateDynamicParms() {
   }
 }
 
+void ResetDynamicParms() {
+
+  /* (batch mode) so that ActivateDynamicParms() sets them again for the next instance */
+
+  UINT32 j;
+  DYNAMICPARM *pCurParm;
+
+  for (j=0;j<iNumDynamicParms;j++) {
+    pCurParm = &(aDynamicParms[j]);
+
+    switch (pCurParm->eDataType) {
+      case DTypeUInt:
+        *((UINT32 *) pCurParm->pTarget) = 0;
+        break;
+      case DTypeSInt:
+        *((SINT32 *) pCurParm->pTarget) = 0;
+        break;
+      case DTypeFloat:
+        *((FLOAT *) pCurParm->pTarget) = FLOATZERO;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 void AddAllocateRAMColumnID(UINT32 j, const char *sItem) {
   REPORTCOL *pCol;
   NOREF(sItem);
@@ -316,6 +377,28 @@ void AddAllocateRAMColumnID(UINT32 j, const char *sItem) {
   ActivateTriggers("AllocateColumnRAM");
 }
 
+void AddStreamColumnID(UINT32 j, const char *sItem) {
+  REPORTCOL *pCol;
+
+  pCol = &aColumns[j];
+
+  /* these columns are only calculated after all of the runs are complete */
+
+  if ((strstr(pCol->sTriggers,"UpdateTimes")) || (strstr(pCol->sTriggers,"UpdatePercents"))) {
+    AddAllocateRAMColumnID(j,sItem);
+    ActivateTriggers("SortByStepPerformance");
+    return;
+  }
+
+  pCol->bStreamColumn = TRUE;
+  ActivateTriggers("AllocateColumnStream");
+}
+
+void AddStreamSolveFailColumnID(UINT32 j, const char *sItem) {
+  AddStreamColumnID(j,sItem);
+  aColumns[j].bStreamSolveFail = aColumns[j].bStreamColumn;
+}
+
 void AddDynamicParm(void *pTarget, enum CDATATYPE eDataType, UINT32 *pBase, FLOAT fFactor) {
 
   if (iNumDynamicParms == 0) {
@@ -360,6 +443,8 @@ void AddColumnFloat(const char *sID,
 
   pCol->bActive = FALSE;
   pCol->bAllocateColumnRAM = FALSE;
+  pCol->bStreamColumn = FALSE;
+  pCol->bStreamSolveFail = FALSE;
 
   SetString(&pCol->sDescription,sDescription);
   SetString(&pCol->sHeader1,sHeader1);
@@ -400,6 +485,8 @@ void AddColumnUInt(const char *sID,
 
   pCol->bActive = FALSE;
   pCol->bAllocateColumnRAM = FALSE;
+  pCol->bStreamColumn = FALSE;
+  pCol->bStreamSolveFail = FALSE;
 
   SetString(&pCol->sDescription,sDescription);
   SetString(&pCol->sHeader1,sHeader1);
@@ -872,6 +959,7 @@ void CheckParamterFile(int iCommandLineCount,char **aCommandLineArgs) {
 
 void ClearActiveProcedures() {
   memset(aNumActiveProcedures,0,sizeof(UINT32) * NUMEVENTPOINTS);
+  memset(aNumSampledProcedures,0,sizeof(UINT32) * NUMEVENTPOINTS);
 }
 
 void CopyParameters(ALGORITHM *pDest, const char *sName, const char *sVar, BOOL bWeighted) {
@@ -969,6 +1057,43 @@ void CreateTrigger(const char *sID, enum EVENTPOINT eEventPoint, FXNPTR pProcedu
   AddItem(&listTriggers,sID);
 }
 
+void CreateSampledTrigger(const char *sID, enum EVENTPOINT eEventPoint, FXNPTR pProcedure, char *sDependencyList, char *sDeactivateList) {
+  aTriggers[listTriggers.iNumItems].bSampled = TRUE;
+  CreateTrigger(sID,eEventPoint,pProcedure,sDependencyList,sDeactivateList);
+}
+
+void SplitSampledProcedures(enum EVENTPOINT eEventPoint) {
+
+  /* moves the procedures of the active sampled triggers (keeping their order)
+     to aSampledProcedures[], which is only run on the sample steps */
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 iNumKept;
+  BOOL bSampled;
+  FXNPTR pProcedure;
+
+  iNumKept = 0;
+
+  for (j=0;j<aNumActiveProcedures[eEventPoint];j++) {
+    pProcedure = aActiveProcedures[eEventPoint][j];
+    bSampled = FALSE;
+    for (k=0;k<listTriggers.iNumItems;k++) {
+      if ((aTriggers[k].pProcedure == pProcedure) && (aTriggers[k].bSampled)) {
+        bSampled = TRUE;
+        break;
+      }
+    }
+    if (bSampled) {
+      aSampledProcedures[eEventPoint][aNumSampledProcedures[eEventPoint]++] = pProcedure;
+    } else {
+      aActiveProcedures[eEventPoint][iNumKept++] = pProcedure;
+    }
+  }
+
+  aNumActiveProcedures[eEventPoint] = iNumKept;
+}
+
 void DeActivateTriggerID(UINT32 iFxnID, const char *sItem) {
   
   UINT32 j;
@@ -1100,6 +1225,16 @@ BOOL IsLocalMinimum(BOOL bUseWeighted) {
   SINT32 iScore;
   FLOAT fScore;
 
+  if (bImproveCount) {
+    if (bUseWeighted) {
+      if (bWeighted) {
+        return(iNumImprovingW == 0);
+      }
+    } else {
+      return(iNumImproving == 0);
+    }
+  }
+
   if (bUseWeighted) {
 
     for (j=1;j<=iNumVars;j++) {
@@ -1603,6 +1738,8 @@ void SetupUBCSAT() {
   iVarFlipHistoryLen = 0;
 
   iNumActiveCalcColumns = 0;
+  iNumActiveMeanColumns = 0;
+  iNumActiveMinMaxColumns = 0;
   iNumAlg = 0;
   iNumDynamicParms = 0;
   iNumOutputColumns = 0;
@@ -26,6 +26,7 @@
 
 #define RunProcedures(A) {if (aNumActiveProcedures[A]) {for (iRunProceduresLoop=0;iRunProceduresLoop<aNumActiveProcedures[A];iRunProceduresLoop++) aActiveProcedures[A][iRunProceduresLoop]();} }
 #define RunProcedures2(A) {if (aNumActiveProcedures[A]) {for (iRunProceduresLoop2=0;iRunProceduresLoop2<aNumActiveProcedures[A];iRunProceduresLoop2++) aActiveProcedures[A][iRunProceduresLoop2]();} }
+#define RunSampledProcedures(A) {if (aNumSampledProcedures[A]) {for (iRunProceduresLoop=0;iRunProceduresLoop<aNumSampledProcedures[A];iRunProceduresLoop++) aSampledProcedures[A][iRunProceduresLoop]();} }
 /* Use RunProcedures2 when calling from outside of the main loop in ubcsat.c */
 
 #define NUMVALIDSTATCODES 30
@@ -53,6 +54,7 @@ extern const char sVersion[];
 extern char *pVersion;
 extern char *sCommentString;
 extern FXNPTR aActiveProcedures[][MAXFXNLIST];
+extern FXNPTR aSampledProcedures[][MAXFXNLIST];
 
 extern BOOL bReportOutputSuppress;
 
@@ -73,6 +75,9 @@ extern BOOL bReportPenaltyReNormFraction;
 
 extern BOOL bReportTriggersAll;
 
+extern UINT32 iReportAnytimeModel;
+extern FLOAT fReportAnytimeInterval;
+
 extern FLOAT fDummy;
 extern FLOAT fFlipsPerSecond;
 extern FLOAT fPercentSuccess;
@@ -89,14 +94,19 @@ extern REPORTSTAT aStats[];
 extern TRIGGER aTriggers[];
 
 extern UINT32 aNumActiveProcedures[];
+extern UINT32 aNumSampledProcedures[];
 
 extern UINT32 aActiveCalcColumns[];
+extern UINT32 aActiveMeanColumns[];
+extern UINT32 aActiveMinMaxColumns[];
 extern UINT32 aOutputColumns[];
 extern UINT32 aRTDColumns[];
 
 extern UINT32 iMobFixedWindow;
 extern BOOL bMobilityFixedIncludeStart;
 extern UINT32 iNumActiveCalcColumns;
+extern UINT32 iNumActiveMeanColumns;
+extern UINT32 iNumActiveMinMaxColumns;
 extern UINT32 iNumAlg;
 extern UINT32 iNumDynamicParms;
 extern UINT32 iNumOutputColumns;
@@ -105,6 +115,9 @@ extern UINT32 iNumRTDColumns;
 extern UINT32 iNumStatsActive;
 extern UINT32 iReportMobilityDisplay;
 extern BOOL bReportMobilityNormalized;
+extern UINT32 iMobilitySample;
+extern FLOAT fRTDPrecision;
+extern UINT32 bReportRTDEstCurve;
 extern UINT32 iRunProceduresLoop;
 extern UINT32 iRunProceduresLoop2;
 extern BOOL bSortedByStepsValid;
@@ -122,6 +135,7 @@ extern char *sFilenameSoln;
 extern char sLine[];
 
 void ActivateDynamicParms();
+void ResetDynamicParms();
 void ActivateAlgorithmTriggers();
 void ActivateColumnID(UINT32 iColID, const char *sItem);
 void ActivateStatID(UINT32 iStatID, const char *sItem);
@@ -131,6 +145,8 @@ void ActivateColumns(char *sColumns);
 void ActivateStats(char *sStats);
 
 void AddAllocateRAMColumnID(UINT32 j, const char *sItem);
+void AddStreamColumnID(UINT32 j, const char *sItem);
+void AddStreamSolveFailColumnID(UINT32 j, const char *sItem);
 void AddOutputColumnID(UINT32 j, const char *sItem);
 void AddParameters();
 void AddParmReport(ALGPARMLIST *pParmList,const char *sSwitch,const char *sName,const char *sDescription,const char *sTriggers);
@@ -146,8 +162,17 @@ void PrintAlgParmSettings(REPORT *pRep, ALGPARMLIST *pParmList);
 void ParseItemList(ITEMLIST *pList, char *sItems, CALLBACKPTR ItemFunction);
 void PrintUBCSATHeader(REPORT *pRep);
 void SetupUBCSAT();
+void SplitSampledProcedures(enum EVENTPOINT eEventPoint);
+
+void InitStreamStat(STREAMSTAT *pStream, BOOL bSolveFail);
+void ResetReportData();
+void StreamStatAdd(STREAMSTAT *pStream, FLOAT fVal, BOOL bFound, FLOAT fSteps);
+void StreamStatMerge(STREAMSTAT *pDest, STREAMSTAT *pSrc);
+BOOL StreamStatWrite(FILE *filOut, STREAMSTAT *pStream);
+BOOL StreamStatRead(FILE *filIn, STREAMSTAT *pStream);
 
 #define GetVarStateBit(VS,B) ((((VS)[(B)>>3])>>(7 - ((B)&0x07)))&0x01)
+#define ToggleVarStateBit(VS,B) ((VS)[(B)>>3] ^= (BYTE) (0x80 >> ((B)&0x07)))
 VARSTATE NewVarState();
 VARSTATE NewCopyVarState(VARSTATE vsCopy);
 void SetCurVarState(VARSTATE vsIn);
@@ -32,6 +32,8 @@
 #ifdef MERSENNE
   extern unsigned long genrand_int32();
   extern void init_genrand(unsigned long s);
+  extern void get_genrand_state(unsigned long *state, int *pos);
+  extern void set_genrand_state(unsigned long *state, int pos);
 
   FXNRAND32 fxnRandUInt32 = genrand_int32;
   #define fxnRandSeed(A) init_genrand(A)
@@ -167,6 +169,7 @@ void CloseSingleFile(FILE *filToClose) {
 
 void CloseReports() {
   UINT32 j;
+  RFFlush();
   for (j=0;j<iNumReports;j++) {
     if (aReports[j].bActive) {
       if (aReports[j].bSpecialFileIO == FALSE) {
@@ -176,6 +179,26 @@ void CloseReports() {
   }
 }
 
+void QuietReports() {
+
+  /* for the worker processes of -coop and -workers: the reports (and
+     -find / -findunique) belong to the original process */
+
+  FILE *filNull;
+  UINT32 j;
+
+  iFind = 0;
+  iFindUnique = 0;
+  bReportEcho = FALSE;
+
+  filNull = fopen("/dev/null","w");
+  for (j=0;j<iNumReports;j++) {
+    if (aReports[j].fileOut) {
+      aReports[j].fileOut = filNull;
+    }
+  }
+}
+
 void AbnormalExit() {
   CloseReports();  
   FreeRAM();
@@ -190,6 +213,479 @@ void CleanExit() {
 FILE *filReportPrint;
 
 
+
+/*
+    Machine readable report output (-rformat json|csv|bin)
+
+    The out, rtd, stats, batch, cnfstats and falsehist reports write through
+    these functions instead of ReportPrint when -rformat is used.
+
+    A report is either a table (a schema followed by one record per row)
+    or a keyed list of named values (stats, cnfstats):
+
+      json   one JSON object per line: the schema, then each row
+             (keyed reports are a single object)
+      csv    a header line of column IDs, then each row
+             (keyed reports are name,value lines)
+      bin    "UBCSATRB", then records of 64-bit little-endian integers
+             and IEEE doubles (see RFBin* for the encoding)
+
+    Output is collected in blocks of REPORTFORMATBUFFERSIZE bytes.
+*/
+
+char *sReportFormat;
+enum REPORTFORMAT eReportFormat;
+
+char aRFBuffer[REPORTFORMATBUFFERSIZE];
+UINT32 iRFBufferLen;
+FILE *filRFBuffer;
+
+BOOL bRFKeyed;
+UINT32 iRFNumFields;
+
+void SetupReportFormat() {
+  if (strcmp(sReportFormat,"text")==0) {
+    eReportFormat = RFormatText;
+  } else if (strcmp(sReportFormat,"json")==0) {
+    eReportFormat = RFormatJSON;
+  } else if (strcmp(sReportFormat,"csv")==0) {
+    eReportFormat = RFormatCSV;
+  } else if (strcmp(sReportFormat,"bin")==0) {
+    eReportFormat = RFormatBin;
+  } else {
+    ReportPrint1(pRepErr,"Error: unknown report format [%s] (must be text, json, csv or bin)\n",sReportFormat);
+    AbnormalExit();
+  }
+
+  /* the comment headers would corrupt the output */
+
+  if (eReportFormat != RFormatText) {
+    bReportClean = TRUE;
+  }
+}
+
+void RFFlush() {
+  if (iRFBufferLen) {
+    fwrite(aRFBuffer,1,iRFBufferLen,filRFBuffer);
+    iRFBufferLen = 0;
+  }
+}
+
+void RFWrite(REPORT *pRep, const void *pData, UINT32 iLen) {
+
+  if ((pRep == NULL) || (!pRep->bActive) || (pRep->fileOut == NULL)) {
+    return;
+  }
+
+  if (pRep->fileOut != filRFBuffer) {
+    RFFlush();
+    filRFBuffer = pRep->fileOut;
+  }
+
+  if (iRFBufferLen + iLen > REPORTFORMATBUFFERSIZE) {
+    RFFlush();
+    if (iLen > REPORTFORMATBUFFERSIZE) {
+      fwrite(pData,1,iLen,filRFBuffer);
+      return;
+    }
+  }
+
+  memcpy(&aRFBuffer[iRFBufferLen],pData,iLen);
+  iRFBufferLen += iLen;
+}
+
+void RFText(REPORT *pRep, const char *sText) {
+  RFWrite(pRep,sText,strlen(sText));
+}
+
+void RFQuoted(REPORT *pRep, const char *sText) {
+
+  /* JSON string, or quoted CSV field */
+
+  char sEsc[8];
+
+  RFText(pRep,"\"");
+  while (*sText) {
+    if (eReportFormat == RFormatCSV) {
+      if (*sText == '"') {
+        RFText(pRep,"\"");
+      }
+      RFWrite(pRep,sText,1);
+    } else if ((*sText == '"') || (*sText == '\\')) {
+      sprintf(sEsc,"\\%c",*sText);
+      RFText(pRep,sEsc);
+    } else if ((unsigned char) *sText < 0x20) {
+      sprintf(sEsc,"\\u%04x",(unsigned char) *sText);
+      RFText(pRep,sEsc);
+    } else {
+      RFWrite(pRep,sText,1);
+    }
+    sText++;
+  }
+  RFText(pRep,"\"");
+}
+
+void RFBinUInt(REPORT *pRep, UINT32 iVal) {
+  unsigned char aBytes[8];
+  UINT32 j;
+  for (j=0;j<8;j++) {
+    aBytes[j] = (unsigned char) (iVal & 0xFF);
+    iVal >>= 8;
+  }
+  RFWrite(pRep,aBytes,8);
+}
+
+void RFBinSInt(REPORT *pRep, SINT32 iVal) {
+  unsigned char aBytes[8];
+  unsigned long long iBits;
+  UINT32 j;
+  iBits = (unsigned long long) (long long) iVal;
+  for (j=0;j<8;j++) {
+    aBytes[j] = (unsigned char) (iBits & 0xFF);
+    iBits >>= 8;
+  }
+  RFWrite(pRep,aBytes,8);
+}
+
+void RFBinFloat(REPORT *pRep, FLOAT fVal) {
+  unsigned long long iBits;
+  double fDouble;
+  unsigned char aBytes[8];
+  UINT32 j;
+  fDouble = (double) fVal;
+  memcpy(&iBits,&fDouble,8);
+  for (j=0;j<8;j++) {
+    aBytes[j] = (unsigned char) (iBits & 0xFF);
+    iBits >>= 8;
+  }
+  RFWrite(pRep,aBytes,8);
+}
+
+void RFBinString(REPORT *pRep, const char *sText) {
+  RFBinUInt(pRep,strlen(sText));
+  RFText(pRep,sText);
+}
+
+const char *RFTypeName(enum CDATATYPE eType) {
+  switch (eType) {
+    case DTypeUInt:
+      return("uint");
+    case DTypeSInt:
+      return("int");
+    case DTypeFloat:
+      return("float");
+    default:
+      return("string");
+  }
+}
+
+char RFTypeCode(enum CDATATYPE eType) {
+  switch (eType) {
+    case DTypeUInt:
+      return('u');
+    case DTypeSInt:
+      return('i');
+    case DTypeFloat:
+      return('f');
+    default:
+      return('s');
+  }
+}
+
+void RFSeparator(REPORT *pRep) {
+  if (iRFNumFields++) {
+    RFText(pRep,",");
+  }
+}
+
+void RFSchemaStart(REPORT *pRep) {
+  iRFNumFields = 0;
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFText(pRep,"{\"report\":");
+      RFQuoted(pRep,pRep->sID);
+      RFText(pRep,",\"columns\":[");
+      break;
+    case RFormatBin:
+      RFText(pRep,"UBCSATRB");
+      RFBinUInt(pRep,1);
+      RFText(pRep,"T");
+      RFBinString(pRep,pRep->sID);
+      break;
+    default:
+      break;
+  }
+}
+
+void RFSchemaColumn(REPORT *pRep, const char *sID, enum CDATATYPE eType, UINT32 iArrayLen, const char *sDescription) {
+
+  /* iArrayLen == 0 for a single value, else the length of an array column */
+
+  char sNum[32];
+  UINT32 j;
+
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFSeparator(pRep);
+      RFText(pRep,"{\"id\":");
+      RFQuoted(pRep,sID);
+      RFText(pRep,",\"type\":");
+      RFQuoted(pRep,RFTypeName(eType));
+      if (iArrayLen) {
+        sprintf(sNum,",\"length\":%lu",(unsigned long) iArrayLen);
+        RFText(pRep,sNum);
+      }
+      RFText(pRep,",\"description\":");
+      RFQuoted(pRep,sDescription);
+      RFText(pRep,"}");
+      break;
+    case RFormatCSV:
+      if (iArrayLen) {
+        for (j=0;j<iArrayLen;j++) {
+          RFSeparator(pRep);
+          sprintf(sNum,"_%lu",(unsigned long) j);
+          RFText(pRep,sID);
+          RFText(pRep,sNum);
+        }
+      } else {
+        RFSeparator(pRep);
+        RFText(pRep,sID);
+      }
+      break;
+    case RFormatBin:
+      RFWrite(pRep,"C",1);
+      sNum[0] = RFTypeCode(eType);
+      RFWrite(pRep,sNum,1);
+      RFBinUInt(pRep,iArrayLen);
+      RFBinString(pRep,sID);
+      break;
+    default:
+      break;
+  }
+}
+
+void RFSchemaEnd(REPORT *pRep) {
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFText(pRep,"]}\n");
+      break;
+    case RFormatCSV:
+      RFText(pRep,"\n");
+      break;
+    case RFormatBin:
+      RFText(pRep,"E");
+      break;
+    default:
+      break;
+  }
+}
+
+void RFRecordStart(REPORT *pRep, BOOL bKeyed) {
+  bRFKeyed = bKeyed;
+  iRFNumFields = 0;
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFText(pRep,"{");
+      if (bKeyed) {
+        RFText(pRep,"\"report\":");
+        RFQuoted(pRep,pRep->sID);
+        iRFNumFields++;
+      }
+      break;
+    case RFormatCSV:
+      if (bKeyed) {
+        RFText(pRep,"name,value\n");
+      }
+      break;
+    case RFormatBin:
+      if (bKeyed) {
+        RFText(pRep,"UBCSATRB");
+        RFBinUInt(pRep,1);
+        RFText(pRep,"K");
+        RFBinString(pRep,pRep->sID);
+      } else {
+        RFText(pRep,"R");
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void RFFieldName(REPORT *pRep, const char *sName, enum CDATATYPE eType) {
+
+  /* the part of a field before the value */
+
+  char sCode[2];
+
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFSeparator(pRep);
+      RFQuoted(pRep,sName);
+      RFText(pRep,":");
+      break;
+    case RFormatCSV:
+      if (bRFKeyed) {
+        RFText(pRep,sName);
+        RFText(pRep,",");
+      } else {
+        RFSeparator(pRep);
+      }
+      break;
+    case RFormatBin:
+      if (bRFKeyed) {
+        sCode[0] = 'V';
+        sCode[1] = RFTypeCode(eType);
+        RFWrite(pRep,sCode,2);
+        RFBinString(pRep,sName);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void RFFieldEnd(REPORT *pRep) {
+  if ((eReportFormat == RFormatCSV) && (bRFKeyed)) {
+    RFText(pRep,"\n");
+  }
+}
+
+void RFNumUInt(REPORT *pRep, UINT32 iVal) {
+  char sNum[32];
+  if (eReportFormat == RFormatBin) {
+    RFBinUInt(pRep,iVal);
+  } else {
+    sprintf(sNum,"%lu",(unsigned long) iVal);
+    RFText(pRep,sNum);
+  }
+}
+
+void RFNumSInt(REPORT *pRep, SINT32 iVal) {
+  char sNum[32];
+  if (eReportFormat == RFormatBin) {
+    RFBinSInt(pRep,iVal);
+  } else {
+    sprintf(sNum,"%ld",(long) iVal);
+    RFText(pRep,sNum);
+  }
+}
+
+void RFNumFloat(REPORT *pRep, FLOAT fVal) {
+  char sNum[32];
+  if (eReportFormat == RFormatBin) {
+    RFBinFloat(pRep,fVal);
+  } else {
+    if (fVal - fVal != FLOATZERO) {
+      /* nan or inf */
+      if (eReportFormat == RFormatJSON) {
+        RFText(pRep,"null");
+      }
+    } else {
+      sprintf(sNum,"%.17g",fVal);
+      RFText(pRep,sNum);
+    }
+  }
+}
+
+void RFFieldUInt(REPORT *pRep, const char *sName, UINT32 iVal) {
+  RFFieldName(pRep,sName,DTypeUInt);
+  RFNumUInt(pRep,iVal);
+  RFFieldEnd(pRep);
+}
+
+void RFFieldSInt(REPORT *pRep, const char *sName, SINT32 iVal) {
+  RFFieldName(pRep,sName,DTypeSInt);
+  RFNumSInt(pRep,iVal);
+  RFFieldEnd(pRep);
+}
+
+void RFFieldFloat(REPORT *pRep, const char *sName, FLOAT fVal) {
+  RFFieldName(pRep,sName,DTypeFloat);
+  RFNumFloat(pRep,fVal);
+  RFFieldEnd(pRep);
+}
+
+void RFFieldString(REPORT *pRep, const char *sName, const char *sVal) {
+  RFFieldName(pRep,sName,DTypeString);
+  if (eReportFormat == RFormatBin) {
+    RFBinString(pRep,sVal);
+  } else {
+    RFQuoted(pRep,sVal);
+  }
+  RFFieldEnd(pRep);
+}
+
+void RFFieldUIntArray(REPORT *pRep, const char *sName, UINT32 iLen, UINT32 *aVals) {
+
+  UINT32 j;
+
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFFieldName(pRep,sName,DTypeUInt);
+      RFText(pRep,"[");
+      for (j=0;j<iLen;j++) {
+        if (j) {
+          RFText(pRep,",");
+        }
+        RFNumUInt(pRep,aVals[j]);
+      }
+      RFText(pRep,"]");
+      break;
+    case RFormatCSV:
+      if (bRFKeyed) {
+        for (j=0;j<iLen;j++) {
+          RFText(pRep,sName);
+          RFText(pRep,"_");
+          RFNumUInt(pRep,j);
+          RFText(pRep,",");
+          RFNumUInt(pRep,aVals[j]);
+          RFText(pRep,"\n");
+        }
+      } else {
+        for (j=0;j<iLen;j++) {
+          RFSeparator(pRep);
+          RFNumUInt(pRep,aVals[j]);
+        }
+      }
+      break;
+    case RFormatBin:
+      if (bRFKeyed) {
+        RFText(pRep,"A");
+        RFText(pRep,"u");
+        RFBinString(pRep,sName);
+        RFBinUInt(pRep,iLen);
+      }
+      for (j=0;j<iLen;j++) {
+        RFBinUInt(pRep,aVals[j]);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void RFRecordEnd(REPORT *pRep) {
+  switch (eReportFormat) {
+    case RFormatJSON:
+      RFText(pRep,"}\n");
+      break;
+    case RFormatCSV:
+      if (!bRFKeyed) {
+        RFText(pRep,"\n");
+      }
+      break;
+    case RFormatBin:
+      if (bRFKeyed) {
+        RFText(pRep,"E");
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+
 FILE *filRandomData;
 char *sFilenameRandomData;
 char *sFilenameAbort;
@@ -273,3 +769,674 @@ void FileAbort() {
   }
 }
 
+
+
+
+/*
+    Signal handling and checkpoints
+
+    SIGINT / SIGTERM stop the current run at the end of the step and
+    SIGUSR1 stops after the current run. The handler only sets flags
+    (of type volatile sig_atomic_t, including bTerminateRun and
+    bTerminateAllRuns), so no system calls are added to the search loop.
+
+    A checkpoint taken mid-run is written at PostStep (before any of the
+    step calculations for that step), so when it is resumed the same
+    step is re-processed by PostStep, StepCalculations and CheckTerminate
+    and the search continues exactly where it left off.
+*/
+
+#define CHECKPOINTMAGIC "UBCSATCK"
+#define CHECKPOINTVERSION 4
+#define CHECKPOINTNAMELEN 64
+#define CHECKPOINTRNGLEN 624
+
+BOOL bCatchSignals;
+char *sFilenameCheckpoint;
+char *sFilenameResume;
+
+volatile sig_atomic_t bSignalStep;
+volatile sig_atomic_t bSignalCaught;
+BOOL bCheckpointStep;
+BOOL bCheckpointWritten;
+
+BOOL bResumeRunPending;
+UINT32 iResumeStep;
+FILE *filResume;
+long iResumeRNGOffset;
+
+void CatchSignal(int iSig) {
+
+  bSignalCaught = TRUE;
+  bTerminateAllRuns = TRUE;
+
+#ifdef SIGUSR1
+  if (iSig == SIGUSR1) {
+    return;
+  }
+#endif
+
+  /* a second SIGINT / SIGTERM will terminate immediately */
+
+  signal(iSig,SIG_DFL);
+
+  if (bCheckpointStep) {
+    bSignalStep = TRUE;
+  } else {
+    bTerminateRun = TRUE;
+  }
+}
+
+void CatchSignals() {
+  bSignalStep = FALSE;
+  bSignalCaught = FALSE;
+  signal(SIGINT,CatchSignal);
+  signal(SIGTERM,CatchSignal);
+#ifdef SIGUSR1
+  signal(SIGUSR1,CatchSignal);
+#endif
+}
+
+BOOL IsTriggerActive(char *sTrigger) {
+  TRIGGER *pTrig;
+  pTrig = &aTriggers[FindItem(&listTriggers,sTrigger)];
+  return((pTrig->bActive) && (!pTrig->bDisabled));
+}
+
+void RunTriggerIfActive(char *sTrigger) {
+  if (IsTriggerActive(sTrigger)) {
+    aTriggers[FindItem(&listTriggers,sTrigger)].pProcedure();
+  }
+}
+
+void CheckpointWrite(FILE *filCkpt, void *pData, size_t iSize) {
+  if (iSize) {
+    if (fwrite(pData,iSize,1,filCkpt) != 1) {
+      ReportPrint1(pRepErr,"Error: unable to write checkpoint file [%s]\n",sFilenameCheckpoint);
+      AbnormalExit();
+    }
+  }
+}
+
+void CheckpointRead(void *pData, size_t iSize) {
+  if (iSize) {
+    if (fread(pData,iSize,1,filResume) != 1) {
+      ReportPrint1(pRepErr,"Error: checkpoint file [%s] is truncated or invalid\n",sFilenameResume);
+      AbnormalExit();
+    }
+  }
+}
+
+void CheckpointName(char *sOut, const char *sIn) {
+  memset(sOut,0,CHECKPOINTNAMELEN);
+  strncpy(sOut,sIn,CHECKPOINTNAMELEN-1);
+}
+
+/* the order of the incremental lists depends on the search history, so it must also be saved */
+
+void CheckpointAlgParms(char *sOut) {
+  UINT32 j;
+  char *pNext;
+  ALGPARM *pCurParm;
+
+  /* the values of the algorithm parameters (at full precision), so that
+     a resume with different parameters is detected */
+
+  pNext = sOut;
+  *pNext = 0;
+  for (j=0;j<pActiveAlgorithm->parmList.iNumParms;j++) {
+    pCurParm = &pActiveAlgorithm->parmList.aParms[j];
+    switch(pCurParm->eType)
+    {
+      case PTypeUInt:
+      case PTypeBool:
+        pNext += sprintf(pNext,"%s %u ",pCurParm->sSwitch,*(UINT32 *)pCurParm->pParmValue);
+        break;
+      case PTypeSInt:
+        pNext += sprintf(pNext,"%s %d ",pCurParm->sSwitch,*(SINT32 *)pCurParm->pParmValue);
+        break;
+      case PTypeProbability:
+        pNext += sprintf(pNext,"%s %.17g ",pCurParm->sSwitch,ProbToFloat(*(PROBABILITY *)pCurParm->pParmValue));
+        break;
+      case PTypeString:
+        pNext += sprintf(pNext,"%s %s ",pCurParm->sSwitch,*(char **)pCurParm->pParmValue);
+        break;
+      case PTypeFloat:
+        pNext += sprintf(pNext,"%s %.17g ",pCurParm->sSwitch,*(FLOAT *)pCurParm->pParmValue);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void CheckpointWriteList(FILE *filCkpt, char *sTrigger, UINT32 *pNum, UINT32 *aList, UINT32 *aListPos, UINT32 iPosLen) {
+  UINT32 bActive;
+  bActive = IsTriggerActive(sTrigger);
+  CheckpointWrite(filCkpt,&bActive,sizeof(UINT32));
+  if (bActive) {
+    CheckpointWrite(filCkpt,pNum,sizeof(UINT32));
+    CheckpointWrite(filCkpt,aList,*pNum * sizeof(UINT32));
+    if (aListPos) {
+      CheckpointWrite(filCkpt,aListPos,iPosLen * sizeof(UINT32));
+    }
+  }
+}
+
+void CheckpointReadList(UINT32 *pNum, UINT32 *aList, UINT32 *aListPos, UINT32 iPosLen) {
+  UINT32 bActive;
+  CheckpointRead(&bActive,sizeof(UINT32));
+  if (bActive) {
+    CheckpointRead(pNum,sizeof(UINT32));
+    CheckpointRead(aList,*pNum * sizeof(UINT32));
+    if (aListPos) {
+      CheckpointRead(aListPos,iPosLen * sizeof(UINT32));
+    }
+  }
+}
+
+void WriteCheckpoint(BOOL bMidRun) {
+
+  FILE *filCkpt;
+  UINT32 j;
+  UINT32 iNumComplete;
+  UINT32 iTemp;
+  REPORTCOL *pCol;
+  char sName[CHECKPOINTNAMELEN];
+  char sParms[MAXPARMLINELEN];
+  unsigned long aRNG[CHECKPOINTRNGLEN];
+  int iRNGPos;
+  char *sTempFilename;
+
+  sTempFilename = AllocateRAM(strlen(sFilenameCheckpoint) + 5);
+  sprintf(sTempFilename,"%s.tmp",sFilenameCheckpoint);
+
+  filCkpt = fopen(sTempFilename,"wb");
+  if (filCkpt == NULL) {
+    ReportPrint1(pRepErr,"Error: unable to write checkpoint file [%s]\n",sFilenameCheckpoint);
+    return;
+  }
+
+  CheckpointWrite(filCkpt,CHECKPOINTMAGIC,8);
+  iTemp = CHECKPOINTVERSION;
+  CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+  CheckpointWrite(filCkpt,&iNumVars,sizeof(UINT32));
+  CheckpointWrite(filCkpt,&iNumClauses,sizeof(UINT32));
+  CheckpointName(sName,pActiveAlgorithm->sName);
+  CheckpointWrite(filCkpt,sName,CHECKPOINTNAMELEN);
+  CheckpointName(sName,pActiveAlgorithm->sVariant);
+  CheckpointWrite(filCkpt,sName,CHECKPOINTNAMELEN);
+  CheckpointWrite(filCkpt,&bWeighted,sizeof(BOOL));
+  CheckpointAlgParms(sParms);
+  iTemp = strlen(sParms) + 1;
+  CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+  CheckpointWrite(filCkpt,sParms,iTemp);
+
+  CheckpointWrite(filCkpt,&bMidRun,sizeof(BOOL));
+  CheckpointWrite(filCkpt,&iRun,sizeof(UINT32));
+  CheckpointWrite(filCkpt,&iNumSolutionsFound,sizeof(UINT32));
+  CheckpointWrite(filCkpt,&iStep,sizeof(UINT32));
+
+#ifdef MERSENNE
+  get_genrand_state(aRNG,&iRNGPos);
+#else
+  memset(aRNG,0,sizeof(aRNG));
+  iRNGPos = 0;
+#endif
+  CheckpointWrite(filCkpt,aRNG,sizeof(aRNG));
+  CheckpointWrite(filCkpt,&iRNGPos,sizeof(int));
+
+  /* results of the completed runs */
+
+  if (bMidRun) {
+    iNumComplete = iRun - 1;
+  } else {
+    iNumComplete = iRun;
+  }
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    CheckpointWrite(filCkpt,&pCol->bActive,sizeof(BOOL));
+    CheckpointWrite(filCkpt,&pCol->bAllocateColumnRAM,sizeof(BOOL));
+    CheckpointWrite(filCkpt,&pCol->bStreamColumn,sizeof(BOOL));
+    if (pCol->bActive) {
+      CheckpointWrite(filCkpt,&pCol->fColSum,sizeof(FLOAT));
+      CheckpointWrite(filCkpt,&pCol->fColSum2,sizeof(FLOAT));
+      CheckpointWrite(filCkpt,&pCol->fRowSum,sizeof(FLOAT));
+      CheckpointWrite(filCkpt,&pCol->fRowSum2,sizeof(FLOAT));
+      CheckpointWrite(filCkpt,&pCol->uiMinMaxVal,sizeof(UINT32));
+      CheckpointWrite(filCkpt,&pCol->siMinMaxVal,sizeof(SINT32));
+      CheckpointWrite(filCkpt,&pCol->fMinMaxVal,sizeof(FLOAT));
+    }
+    if (pCol->bAllocateColumnRAM) {
+      switch (pCol->eFinalDataType) {
+        case DTypeUInt:
+          CheckpointWrite(filCkpt,pCol->puiColumnData,iNumComplete * sizeof(UINT32));
+          break;
+        case DTypeSInt:
+          CheckpointWrite(filCkpt,pCol->psiColumnData,iNumComplete * sizeof(SINT32));
+          break;
+        case DTypeFloat:
+          CheckpointWrite(filCkpt,pCol->pfColumnData,iNumComplete * sizeof(FLOAT));
+          break;
+        default:
+          break;
+      }
+    }
+    if (pCol->bStreamColumn) {
+      if (!StreamStatWrite(filCkpt,pCol->pStreamData)) {
+        ReportPrint1(pRepErr,"Error: unable to write checkpoint file [%s]\n",sFilenameCheckpoint);
+        AbnormalExit();
+      }
+    }
+  }
+
+  /* search state of the current run */
+
+  if (bMidRun) {
+
+    CheckpointWrite(filCkpt,aVarValue,(iNumVars+1) * sizeof(UINT32));
+
+    CheckpointWrite(filCkpt,&bClausePenaltyCreated,sizeof(BOOL));
+    CheckpointWrite(filCkpt,&bClausePenaltyFLOAT,sizeof(BOOL));
+    if (bClausePenaltyCreated) {
+      if (bClausePenaltyFLOAT) {
+        CheckpointWrite(filCkpt,aClausePenaltyFL,iNumClauses * sizeof(FLOAT));
+        CheckpointWrite(filCkpt,&fBasePenaltyFL,sizeof(FLOAT));
+        CheckpointWrite(filCkpt,&fTotalPenaltyFL,sizeof(FLOAT));
+
+        /* saved rather than rebuilt, so that the rounding errors are identical */
+
+        iTemp = IsTriggerActive("InitMakeBreakPenaltyFL");
+        CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+        if (iTemp) {
+          CheckpointWrite(filCkpt,aMakePenaltyFL,(iNumVars+1) * sizeof(FLOAT));
+          CheckpointWrite(filCkpt,aBreakPenaltyFL,(iNumVars+1) * sizeof(FLOAT));
+        }
+      } else {
+        CheckpointWrite(filCkpt,aClausePenaltyINT,iNumClauses * sizeof(UINT32));
+        CheckpointWrite(filCkpt,&iBasePenaltyINT,sizeof(UINT32));
+        CheckpointWrite(filCkpt,&iTotalPenaltyINT,sizeof(UINT32));
+      }
+    }
+
+    iTemp = IsTriggerActive("InitVarLastChange");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      CheckpointWrite(filCkpt,aVarLastChange,(iNumVars+1) * sizeof(UINT32));
+    }
+
+    CheckpointWrite(filCkpt,&iBestNumFalse,sizeof(UINT32));
+    CheckpointWrite(filCkpt,&iBestStepNumFalse,sizeof(UINT32));
+    CheckpointWrite(filCkpt,&fBestSumFalseW,sizeof(FLOAT));
+    CheckpointWrite(filCkpt,&iBestStepSumFalseW,sizeof(UINT32));
+
+    iTemp = IsTriggerActive("CreateSaveBest");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      MaterializeSaveBest();
+      CheckpointWrite(filCkpt,vsBest,iVARSTATELen);
+    }
+
+    CheckpointWriteList(filCkpt,"InitFalseClauseList",&iNumFalseList,aFalseList,aFalseListPos,iNumClauses);
+    CheckpointWriteList(filCkpt,"InitVarInFalse",&iNumVarsInFalseList,aVarInFalseList,aVarInFalseListPos,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitDecPromVars",&iNumDecPromVars,aDecPromVarsList,aDecPromVarsListPos,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitDecPromVarsW",&iNumDecPromVarsW,aDecPromVarsListW,aDecPromVarsListPosW,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitDecPromBest",&hDecPromBest.iNum,hDecPromBest.aHeap,hDecPromBest.aHeapPos,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitDecPromOldest",&hDecPromOldest.iNum,hDecPromOldest.aHeap,hDecPromOldest.aHeapPos,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitDecPromBestW",&hDecPromBestW.iNum,hDecPromBestW.aHeap,hDecPromBestW.aHeapPos,iNumVars+1);
+    CheckpointWriteList(filCkpt,"InitBestScoreList",&iNumBestScoreList,aBestScoreList,aBestScoreListPos,iNumVars+1);
+
+    iTemp = IsTriggerActive("InitDecPromVars");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      CheckpointWrite(filCkpt,&iDecPromVarsSeq,sizeof(UINT32));
+      CheckpointWrite(filCkpt,aDecPromVarsSeq,(iNumVars+1) * sizeof(UINT32));
+    }
+
+    iTemp = IsTriggerActive("InitDecPromBest");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      CheckpointWrite(filCkpt,aDecPromBestScore,(iNumVars+1) * sizeof(SINT32));
+    }
+
+    iTemp = IsTriggerActive("InitDecPromVarsW");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      CheckpointWrite(filCkpt,&iDecPromVarsSeqW,sizeof(UINT32));
+      CheckpointWrite(filCkpt,aDecPromVarsSeqW,(iNumVars+1) * sizeof(UINT32));
+    }
+
+    iTemp = IsTriggerActive("InitDecPromBestW");
+    CheckpointWrite(filCkpt,&iTemp,sizeof(UINT32));
+    if (iTemp) {
+      CheckpointWrite(filCkpt,aDecPromBestScoreW,(iNumVars+1) * sizeof(FLOAT));
+    }
+  }
+
+  fclose(filCkpt);
+
+  remove(sFilenameCheckpoint);
+  if (rename(sTempFilename,sFilenameCheckpoint)) {
+    ReportPrint1(pRepErr,"Error: unable to write checkpoint file [%s]\n",sFilenameCheckpoint);
+    return;
+  }
+
+  bCheckpointWritten = TRUE;
+}
+
+void InitCheckpoint() {
+  bCheckpointStep = TRUE;
+  bCheckpointWritten = FALSE;
+}
+
+void WriteCheckpointStep() {
+  if (bSignalStep) {
+    WriteCheckpoint(TRUE);
+    bSignalStep = FALSE;
+    bTerminateRun = TRUE;
+  }
+}
+
+void WriteCheckpointFinal() {
+
+  /* SIGUSR1, or a signal that arrived outside of the search steps */
+
+  if ((bSignalCaught) && (!bCheckpointWritten)) {
+    WriteCheckpoint(FALSE);
+  }
+}
+
+void LoadCheckpoint() {
+
+  UINT32 j;
+  UINT32 iTemp;
+  UINT32 iNumComplete;
+  BOOL bMidRun;
+  BOOL bTemp;
+  BOOL bWeightedCkpt;
+  BOOL bColActive;
+  BOOL bColRAM;
+  BOOL bColStream;
+  REPORTCOL *pCol;
+  char sMagic[8];
+  char sName[CHECKPOINTNAMELEN];
+  char sCheck[CHECKPOINTNAMELEN];
+  char sParms[MAXPARMLINELEN];
+  char sParmsCheck[MAXPARMLINELEN];
+  unsigned long aRNG[CHECKPOINTRNGLEN];
+  int iRNGPos;
+
+  bResumeRunPending = FALSE;
+
+  SetupFile(&filResume,"rb",sFilenameResume,NULL,FALSE);
+
+  CheckpointRead(sMagic,8);
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if ((strncmp(sMagic,CHECKPOINTMAGIC,8)) || (iTemp != CHECKPOINTVERSION)) {
+    ReportPrint1(pRepErr,"Error: [%s] is not a valid checkpoint file\n",sFilenameResume);
+    AbnormalExit();
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp != iNumVars) {
+    ReportPrint1(pRepErr,"Error: checkpoint file [%s] is for a different instance\n",sFilenameResume);
+    AbnormalExit();
+  }
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp != iNumClauses) {
+    ReportPrint1(pRepErr,"Error: checkpoint file [%s] is for a different instance\n",sFilenameResume);
+    AbnormalExit();
+  }
+
+  CheckpointRead(sName,CHECKPOINTNAMELEN);
+  CheckpointName(sCheck,pActiveAlgorithm->sName);
+  bTemp = (strcmp(sName,sCheck) == 0);
+  CheckpointRead(sName,CHECKPOINTNAMELEN);
+  CheckpointName(sCheck,pActiveAlgorithm->sVariant);
+  bTemp = bTemp && (strcmp(sName,sCheck) == 0);
+  CheckpointRead(&bWeightedCkpt,sizeof(BOOL));
+  if ((!bTemp) || (bWeightedCkpt != bWeighted)) {
+    ReportPrint1(pRepErr,"Error: checkpoint file [%s] is for a different algorithm\n",sFilenameResume);
+    AbnormalExit();
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if ((iTemp == 0) || (iTemp > MAXPARMLINELEN)) {
+    ReportPrint1(pRepErr,"Error: [%s] is not a valid checkpoint file\n",sFilenameResume);
+    AbnormalExit();
+  }
+  CheckpointRead(sParms,iTemp);
+  sParms[iTemp-1] = 0;
+  CheckpointAlgParms(sParmsCheck);
+  if (strcmp(sParms,sParmsCheck)) {
+    ReportPrint1(pRepErr,"Error: checkpoint file [%s] was created with different algorithm parameters:\n",sFilenameResume);
+    ReportPrint1(pRepErr,"  %s\n",sParms);
+    AbnormalExit();
+  }
+
+  CheckpointRead(&bMidRun,sizeof(BOOL));
+  CheckpointRead(&iRun,sizeof(UINT32));
+  CheckpointRead(&iNumSolutionsFound,sizeof(UINT32));
+  CheckpointRead(&iResumeStep,sizeof(UINT32));
+
+  iResumeRNGOffset = ftell(filResume);
+  CheckpointRead(aRNG,sizeof(aRNG));
+  CheckpointRead(&iRNGPos,sizeof(int));
+
+  if (bMidRun) {
+    iNumComplete = iRun - 1;
+  } else {
+    iNumComplete = iRun;
+  }
+
+  if (iNumComplete >= iNumRuns) {
+    ReportPrint1(pRepErr,"Warning: all runs in checkpoint file [%s] are complete\n",sFilenameResume);
+  }
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    CheckpointRead(&bColActive,sizeof(BOOL));
+    CheckpointRead(&bColRAM,sizeof(BOOL));
+    CheckpointRead(&bColStream,sizeof(BOOL));
+    if ((bColActive != pCol->bActive) || (bColRAM != pCol->bAllocateColumnRAM) || (bColStream != pCol->bStreamColumn)) {
+      ReportPrint1(pRepErr,"Error: checkpoint file [%s] was created with different reports or columns\n",sFilenameResume);
+      AbnormalExit();
+    }
+    if (pCol->bActive) {
+      CheckpointRead(&pCol->fColSum,sizeof(FLOAT));
+      CheckpointRead(&pCol->fColSum2,sizeof(FLOAT));
+      CheckpointRead(&pCol->fRowSum,sizeof(FLOAT));
+      CheckpointRead(&pCol->fRowSum2,sizeof(FLOAT));
+      CheckpointRead(&pCol->uiMinMaxVal,sizeof(UINT32));
+      CheckpointRead(&pCol->siMinMaxVal,sizeof(SINT32));
+      CheckpointRead(&pCol->fMinMaxVal,sizeof(FLOAT));
+    }
+    if (pCol->bAllocateColumnRAM) {
+      switch (pCol->eFinalDataType) {
+        case DTypeUInt:
+          CheckpointRead(pCol->puiColumnData,iNumComplete * sizeof(UINT32));
+          break;
+        case DTypeSInt:
+          CheckpointRead(pCol->psiColumnData,iNumComplete * sizeof(SINT32));
+          break;
+        case DTypeFloat:
+          CheckpointRead(pCol->pfColumnData,iNumComplete * sizeof(FLOAT));
+          break;
+        default:
+          break;
+      }
+    }
+    if (pCol->bStreamColumn) {
+      if (!StreamStatRead(filResume,pCol->pStreamData)) {
+        ReportPrint1(pRepErr,"Error: checkpoint file [%s] is truncated or invalid\n",sFilenameResume);
+        AbnormalExit();
+      }
+    }
+  }
+
+#ifdef MERSENNE
+  set_genrand_state(aRNG,iRNGPos);
+#endif
+
+  if (bMidRun) {
+
+    /* the rest of the file is read when the interrupted run is re-initialized */
+
+    iRun--;
+    bResumeRunPending = TRUE;
+
+  } else {
+    CloseSingleFile(filResume);
+  }
+}
+
+void ResumeCheckpointRun() {
+
+  UINT32 j;
+  UINT32 iTemp;
+  BOOL bPenCreated;
+  BOOL bPenFloat;
+  unsigned long aRNG[CHECKPOINTRNGLEN];
+  int iRNGPos;
+  REPORTCOL *pCol;
+  FLOAT fRowSum;
+  FLOAT fRowSum2;
+  UINT32 uiMinMax;
+  SINT32 siMinMax;
+  FLOAT fMinMax;
+
+  if (!bResumeRunPending) {
+    return;
+  }
+  bResumeRunPending = FALSE;
+
+  /* re-read the header for the RNG state and the column row accumulators,
+     which have been reset by the PreRun/PostInit of this run */
+
+  fseek(filResume,iResumeRNGOffset,SEEK_SET);
+  CheckpointRead(aRNG,sizeof(aRNG));
+  CheckpointRead(&iRNGPos,sizeof(int));
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    fseek(filResume,3 * sizeof(BOOL),SEEK_CUR);
+    if (pCol->bActive) {
+      fseek(filResume,2 * sizeof(FLOAT),SEEK_CUR);
+      CheckpointRead(&fRowSum,sizeof(FLOAT));
+      CheckpointRead(&fRowSum2,sizeof(FLOAT));
+      CheckpointRead(&uiMinMax,sizeof(UINT32));
+      CheckpointRead(&siMinMax,sizeof(SINT32));
+      CheckpointRead(&fMinMax,sizeof(FLOAT));
+      pCol->fRowSum = fRowSum;
+      pCol->fRowSum2 = fRowSum2;
+      pCol->uiMinMaxVal = uiMinMax;
+      pCol->siMinMaxVal = siMinMax;
+      pCol->fMinMaxVal = fMinMax;
+    }
+    if (pCol->bAllocateColumnRAM) {
+      switch (pCol->eFinalDataType) {
+        case DTypeUInt:
+          fseek(filResume,(iRun - 1) * sizeof(UINT32),SEEK_CUR);
+          break;
+        case DTypeSInt:
+          fseek(filResume,(iRun - 1) * sizeof(SINT32),SEEK_CUR);
+          break;
+        case DTypeFloat:
+          fseek(filResume,(iRun - 1) * sizeof(FLOAT),SEEK_CUR);
+          break;
+        default:
+          break;
+      }
+    }
+    if (pCol->bStreamColumn) {
+      StreamStatRead(filResume,pCol->pStreamData);
+    }
+  }
+
+  /* rebuild all of the state information from the saved assignment */
+
+  CheckpointRead(aVarValue,(iNumVars+1) * sizeof(UINT32));
+
+  RunProcedures2(InitStateInfo);
+
+  CheckpointRead(&bPenCreated,sizeof(BOOL));
+  CheckpointRead(&bPenFloat,sizeof(BOOL));
+  if ((bPenCreated != bClausePenaltyCreated) || ((bPenCreated) && (bPenFloat != bClausePenaltyFLOAT))) {
+    ReportPrint1(pRepErr,"Error: checkpoint file [%s] is for a different algorithm\n",sFilenameResume);
+    AbnormalExit();
+  }
+  if (bPenCreated) {
+    if (bPenFloat) {
+      CheckpointRead(aClausePenaltyFL,iNumClauses * sizeof(FLOAT));
+      CheckpointRead(&fBasePenaltyFL,sizeof(FLOAT));
+      CheckpointRead(&fTotalPenaltyFL,sizeof(FLOAT));
+      CheckpointRead(&iTemp,sizeof(UINT32));
+      if (iTemp) {
+        CheckpointRead(aMakePenaltyFL,(iNumVars+1) * sizeof(FLOAT));
+        CheckpointRead(aBreakPenaltyFL,(iNumVars+1) * sizeof(FLOAT));
+      }
+    } else {
+      CheckpointRead(aClausePenaltyINT,iNumClauses * sizeof(UINT32));
+      CheckpointRead(&iBasePenaltyINT,sizeof(UINT32));
+      CheckpointRead(&iTotalPenaltyINT,sizeof(UINT32));
+      RunTriggerIfActive("InitMakeBreakPenaltyINT");
+      RunTriggerIfActive("InitPenClauseList");
+    }
+    PenaltyStatsChangeAll();
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(aVarLastChange,(iNumVars+1) * sizeof(UINT32));
+  }
+
+  CheckpointRead(&iBestNumFalse,sizeof(UINT32));
+  CheckpointRead(&iBestStepNumFalse,sizeof(UINT32));
+  CheckpointRead(&fBestSumFalseW,sizeof(FLOAT));
+  CheckpointRead(&iBestStepSumFalseW,sizeof(UINT32));
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(vsBest,iVARSTATELen);
+  }
+
+  CheckpointReadList(&iNumFalseList,aFalseList,aFalseListPos,iNumClauses);
+  CheckpointReadList(&iNumVarsInFalseList,aVarInFalseList,aVarInFalseListPos,iNumVars+1);
+  CheckpointReadList(&iNumDecPromVars,aDecPromVarsList,aDecPromVarsListPos,iNumVars+1);
+  CheckpointReadList(&iNumDecPromVarsW,aDecPromVarsListW,aDecPromVarsListPosW,iNumVars+1);
+  CheckpointReadList(&hDecPromBest.iNum,hDecPromBest.aHeap,hDecPromBest.aHeapPos,iNumVars+1);
+  CheckpointReadList(&hDecPromOldest.iNum,hDecPromOldest.aHeap,hDecPromOldest.aHeapPos,iNumVars+1);
+  CheckpointReadList(&hDecPromBestW.iNum,hDecPromBestW.aHeap,hDecPromBestW.aHeapPos,iNumVars+1);
+  CheckpointReadList(&iNumBestScoreList,aBestScoreList,aBestScoreListPos,iNumVars+1);
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(&iDecPromVarsSeq,sizeof(UINT32));
+    CheckpointRead(aDecPromVarsSeq,(iNumVars+1) * sizeof(UINT32));
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(aDecPromBestScore,(iNumVars+1) * sizeof(SINT32));
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(&iDecPromVarsSeqW,sizeof(UINT32));
+    CheckpointRead(aDecPromVarsSeqW,(iNumVars+1) * sizeof(UINT32));
+  }
+
+  CheckpointRead(&iTemp,sizeof(UINT32));
+  if (iTemp) {
+    CheckpointRead(aDecPromBestScoreW,(iNumVars+1) * sizeof(FLOAT));
+  }
+
+  CloseSingleFile(filResume);
+
+#ifdef MERSENNE
+  set_genrand_state(aRNG,iRNGPos);
+#endif
+
+  iStep = iResumeStep;
+}
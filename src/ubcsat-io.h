@@ -35,6 +35,7 @@ void AbnormalExit();
 void CleanExit();
 
 void CloseSingleFile(FILE *filToClose);
+void QuietReports();
 
 void SetupFile(FILE **fFil,const char *sOpenType, const char *sFilename, FILE *filDefault, BOOL bAllowNull);
 
@@ -63,4 +64,32 @@ void CreateFileRandom();
 void CloseFileRandom();
 void FileAbort();
 
+extern char *sReportFormat;
+extern enum REPORTFORMAT eReportFormat;
+void SetupReportFormat();
+void RFFlush();
+void RFSchemaStart(REPORT *pRep);
+void RFSchemaColumn(REPORT *pRep, const char *sID, enum CDATATYPE eType, UINT32 iArrayLen, const char *sDescription);
+void RFSchemaEnd(REPORT *pRep);
+void RFRecordStart(REPORT *pRep, BOOL bKeyed);
+void RFFieldUInt(REPORT *pRep, const char *sName, UINT32 iVal);
+void RFFieldSInt(REPORT *pRep, const char *sName, SINT32 iVal);
+void RFFieldFloat(REPORT *pRep, const char *sName, FLOAT fVal);
+void RFFieldString(REPORT *pRep, const char *sName, const char *sVal);
+void RFFieldUIntArray(REPORT *pRep, const char *sName, UINT32 iLen, UINT32 *aVals);
+void RFRecordEnd(REPORT *pRep);
+
+extern BOOL bCatchSignals;
+extern volatile sig_atomic_t bSignalCaught;
+extern char *sFilenameCheckpoint;
+extern char *sFilenameResume;
+void CatchSignals();
+void InitCheckpoint();
+void WriteCheckpointStep();
+void WriteCheckpointFinal();
+void LoadCheckpoint();
+void ResumeCheckpointRun();
+BOOL IsTriggerActive(char *sTrigger);
+void RunTriggerIfActive(char *sTrigger);
+
 
@@ -26,7 +26,7 @@
 #define LITSPERCHUNK 262144
 
 #define MAXNUMALG 128
-#define MAXALGPARMS 16
+#define MAXALGPARMS 32
 
 #define MAXFXNLIST 32
 
@@ -45,7 +45,43 @@
 
 #define RANDOMFILEBUFFERSIZE 1048576
 
+#define REPORTFORMATBUFFERSIZE 65536
+
 #define HELPSTRINGLENGTH 128
 
 #define MAXDYNAMICPARMS 16
 
+#define QSKETCHSIZE 1024
+#define QSKETCHMAXLEVELS 32
+
+#define MAXTHREADS 64
+#define PARALLELMINITEMS 65536
+#define POOLSPIN 100000
+
+#define MAXCOOPWORKERS 64
+
+#define MAXFARMWORKERS 256
+#define FARMPOLLMASK 0x0000FFFF
+
+#define AUTOCORRFFTMINLEN 256
+
+#define RTDESTZ 1.959963985
+#define RTDESTMINRUNS 10
+#define RTDESTINITRUNS 1024
+#define RTDESTCALCFRAC 32
+
+#define RESTARTADAPTMAXTRIES 65536
+#define RESTARTADAPTMINFOUND 5
+#define RESTARTADAPTMINSHAPE 0.01
+#define RESTARTADAPTMAXSHAPE 100.0
+#define RESTARTADAPTITERATIONS 60
+#define RESTARTADAPTMAXTAIL 20.0
+#define RESTARTADAPTGRID 1000
+#define RESTARTADAPTREFITFRAC 8
+
+#define MAXSERVEWORKERS 256
+#define SERVEBACKLOG 64
+#define SERVEPOLLMS 1000
+
+#define ANYTIMECLOCKMASK 0x000000FF
+
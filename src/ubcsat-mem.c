@@ -35,10 +35,16 @@ typedef struct typeUBCSATHEAP {
   char *pHeap;
   char *pFree;
   size_t iBytesFree;
+  size_t iSize;
 } UBCSATHEAP;
 
 UBCSATHEAP aHeap[MAXHEAPS];
 
+/* (MarkRAM / ReleaseRAM) */
+
+UINT32 iNumHeapMark;
+UBCSATHEAP aHeapMark[MAXHEAPS];
+
 void *AllocateRAM( size_t size ) {
   UINT32 j;
   BOOL bFound;
@@ -63,10 +69,12 @@ void *AllocateRAM( size_t size ) {
       aHeap[iNumHeap].pHeap = malloc(size);
       aHeap[iNumHeap].pFree = aHeap[iNumHeap].pHeap;
       aHeap[iNumHeap].iBytesFree = size;
+      aHeap[iNumHeap].iSize = size;
     } else {
       aHeap[iNumHeap].pHeap = malloc(DEFAULTHEAPSIZE);
       aHeap[iNumHeap].pFree = aHeap[iNumHeap].pHeap;
       aHeap[iNumHeap].iBytesFree = DEFAULTHEAPSIZE;
+      aHeap[iNumHeap].iSize = DEFAULTHEAPSIZE;
     }
     iHeapID = iNumHeap;
     iNumHeap++;
@@ -94,6 +102,36 @@ void SetString(char **sNew, const char *sSrc) {
   strcpy(*sNew,sSrc);
 }
 
+/*
+    MarkRAM() remembers the current end of every heap, and ReleaseRAM()
+    gives back everything allocated since then (without freeing the heaps)
+    so that batch mode (-instlist) can reuse the same memory for each instance
+*/
+
+void MarkRAM() {
+
+  UINT32 j;
+
+  iNumHeapMark = iNumHeap;
+  for (j=0;j<iNumHeap;j++) {
+    aHeapMark[j] = aHeap[j];
+  }
+}
+
+void ReleaseRAM() {
+
+  UINT32 j;
+
+  for (j=0;j<iNumHeapMark;j++) {
+    aHeap[j].pFree = aHeapMark[j].pFree;
+    aHeap[j].iBytesFree = aHeapMark[j].iBytesFree;
+  }
+  for (j=iNumHeapMark;j<iNumHeap;j++) {
+    aHeap[j].pFree = aHeap[j].pHeap;
+    aHeap[j].iBytesFree = aHeap[j].iSize;
+  }
+}
+
 void FreeRAM() {
   
   UINT32 j;
@@ -25,5 +25,7 @@ void AdjustLastRAM( size_t size );
 void PrintMemUsage();
 void SetString(char **sNew, const char *sSrc);
 void FreeRAM();
+void MarkRAM();
+void ReleaseRAM();
 
 extern UINT32 iNumHeap;
@@ -44,6 +44,37 @@ void ReportStatsPrint();
 void ReportRTDSetup();
 void ReportRTDPrint();
 
+/***** Trigger RTDEstimate *****/
+void InitRTDEstimate();
+void UpdateRTDEstimate();
+FLOAT fRTDPrecision;
+typedef struct typeRTDESTITEM {
+  FLOAT fVal;
+  BOOL bFound;
+} RTDESTITEM;
+
+UINT32 iNumRTDEst;
+UINT32 iMaxRTDEst;
+UINT32 iNumRTDEstCalc;
+UINT32 iNextRTDEstCalc;
+RTDESTITEM *aRTDEstSteps;
+RTDESTITEM *aRTDEstTimes;
+FLOAT fRTDEstProb;
+FLOAT fRTDEstProbLow;
+FLOAT fRTDEstProbHigh;
+FLOAT fRTDEstSteps;
+FLOAT fRTDEstStepsLow;
+FLOAT fRTDEstStepsHigh;
+FLOAT fRTDEstTime;
+FLOAT fRTDEstTimeLow;
+FLOAT fRTDEstTimeHigh;
+FLOAT fRTDEstError;
+BOOL bRTDEstStopped;
+
+/***** Trigger ReportRTDEstPrint *****/
+void ReportRTDEstPrint();
+UINT32 bReportRTDEstCurve;
+
 /***** Trigger ReportModelPrint *****/
 void ReportModelPrint();
 
@@ -123,6 +154,7 @@ void ReportPenCVPrint();
 void ReportMobilityPrint();
 UINT32 iReportMobilityDisplay;
 BOOL bReportMobilityNormalized;
+UINT32 iMobilitySample;
 
 /***** Trigger ReportMobFixedPrint *****/
 void ReportMobFixedPrint();
@@ -141,12 +173,35 @@ void ReportTriggersPrint();
 /***** Trigger ReportSatCompetitionPrint *****/
 void ReportSatCompetitionPrint();
 
+/***** Trigger ReportAnytime *****/
+void ReportAnytimeSetup();
+void ReportAnytimeStep();
+void ReportAnytimeRun();
+void ReportAnytimeFinal();
+UINT32 iReportAnytimeModel;
+FLOAT fReportAnytimeInterval;
+UINT32 iAnytimeBest;
+FLOAT fAnytimeBestW;
+BOOL bAnytimeFound;
+BOOL bAnytimePending;
+double fAnytimeLastPrint;
+VARSTATE vsAnytime;
+
+/***** Trigger ReportBatch *****/
+void ReportBatchSetup();
+void ReportBatchRow();
+UINT32 iNumBatchColumns;
+UINT32 aBatchColumns[MAXITEMLIST];
+
 /***** Trigger ActivateStepsFoundColumns *****/
 void ActivateStepsFoundColumns();
 
 /***** Trigger AllocateColumnRAM *****/
 void AllocateColumnRAM();
 
+/***** Trigger AllocateColumnStream *****/
+void AllocateColumnStream();
+
 /***** Trigger CalcPercentSolve *****/
 void CalcPercentSolve();
 FLOAT fPercentSuccess;
@@ -157,6 +212,353 @@ void ColumnRunCalculation();
 /***** Trigger ColumnStepCalculation *****/
 void ColumnStepCalculation();
 
+/***** Trigger ColumnStepMeanCalculation *****/
+void ColumnStepMeanCalculation();
+
+/***** Trigger AllocateColumnStream *****/
+
+/*
+    With -rstream, the stats report does not store one value per run.
+    Each column keeps a running mean & variance (Welford) and a
+    quantile sketch: a stack of QSKETCHSIZE buffers where a full buffer
+    is sorted and every second value is promoted to the next level with
+    twice the weight.  The sketch is exact until QSKETCHSIZE runs, uses
+    O(QSKETCHSIZE * log(runs)) memory, and two sketches can be merged.
+*/
+
+typedef struct typeQSKETCHITEM {
+  FLOAT fVal;
+  UINT32 iWeight;
+} QSKETCHITEM;
+
+QSKETCHITEM *aQSketchItems;
+
+void InitQSketch(QSKETCH *pSketch) {
+  UINT32 j;
+  pSketch->iNumLevels = 0;
+  pSketch->iCount = 0;
+  pSketch->iCompactions = 0;
+  for (j=0;j<QSKETCHMAXLEVELS;j++) {
+    pSketch->aLevelSize[j] = 0;
+    pSketch->aLevel[j] = NULL;
+  }
+}
+
+void InitStreamStat(STREAMSTAT *pStream, BOOL bSolveFail) {
+  pStream->iCount = 0;
+  pStream->fMean = FLOATZERO;
+  pStream->fM2 = FLOATZERO;
+  pStream->fMin = FLOATMAX;
+  pStream->fMax = -FLOATMAX;
+  pStream->fStepSum = FLOATZERO;
+  pStream->fStepProductSum = FLOATZERO;
+  InitQSketch(&pStream->qsAll);
+
+  pStream->bSolveFail = bSolveFail;
+  pStream->iCountSolve = 0;
+  pStream->fSumSolve = FLOATZERO;
+  pStream->fSumFail = FLOATZERO;
+  pStream->fMinSolve = FLOATMAX;
+  pStream->fMaxSolve = -FLOATMAX;
+  pStream->fMinFail = FLOATMAX;
+  pStream->fMaxFail = -FLOATMAX;
+  InitQSketch(&pStream->qsSolve);
+  InitQSketch(&pStream->qsFail);
+}
+
+int CompareFloat(const void *a, const void *b) {
+  if (*(FLOAT *)a < *(FLOAT *)b) {
+    return(-1);
+  } else if (*(FLOAT *)a > *(FLOAT *)b) {
+    return(1);
+  }
+  return(0);
+}
+
+void QSketchInsert(QSKETCH *pSketch, UINT32 iLevel, FLOAT fVal) {
+
+  UINT32 j;
+  FLOAT *aLevel;
+
+  if (iLevel >= QSKETCHMAXLEVELS) {
+    ReportPrint1(pRepErr,"Unexpected Error: increase constant QSKETCHMAXLEVELS [%u] \n",QSKETCHMAXLEVELS);
+    AbnormalExit();
+  }
+
+  if (pSketch->aLevel[iLevel] == NULL) {
+    pSketch->aLevel[iLevel] = AllocateRAM(QSKETCHSIZE * sizeof(FLOAT));
+    pSketch->iNumLevels = iLevel + 1;
+  }
+
+  aLevel = pSketch->aLevel[iLevel];
+  aLevel[pSketch->aLevelSize[iLevel]++] = fVal;
+
+  if (pSketch->aLevelSize[iLevel] == QSKETCHSIZE) {
+
+    /* compact: keep the odd or even positions of the sorted buffer (alternating, to avoid bias) */
+
+    qsort((void *)aLevel,QSKETCHSIZE,sizeof(FLOAT),CompareFloat);
+    pSketch->aLevelSize[iLevel] = 0;
+    for (j=(pSketch->iCompactions++ & 1);j<QSKETCHSIZE;j+=2) {
+      QSketchInsert(pSketch,iLevel+1,aLevel[j]);
+    }
+  }
+}
+
+void QSketchMerge(QSKETCH *pDest, QSKETCH *pSrc) {
+  UINT32 j,k;
+  for (j=0;j<pSrc->iNumLevels;j++) {
+    for (k=0;k<pSrc->aLevelSize[j];k++) {
+      QSketchInsert(pDest,j,pSrc->aLevel[j][k]);
+    }
+  }
+  pDest->iCount += pSrc->iCount;
+}
+
+int CompareQSketchItem(const void *a, const void *b) {
+  return(CompareFloat(&((QSKETCHITEM *)a)->fVal,&((QSKETCHITEM *)b)->fVal));
+}
+
+FLOAT QSketchElement(QSKETCH *pSketch, UINT32 iPos) {
+
+  /* (approximately) the element at position iPos of the sorted column */
+
+  UINT32 j,k;
+  UINT32 iNumItems = 0;
+  UINT32 iRank = 0;
+
+  if (pSketch->iCount == 0) {
+    return(FLOATZERO);
+  }
+
+  if (aQSketchItems == NULL) {
+    aQSketchItems = AllocateRAM(QSKETCHMAXLEVELS * QSKETCHSIZE * sizeof(QSKETCHITEM));
+  }
+
+  for (j=0;j<pSketch->iNumLevels;j++) {
+    for (k=0;k<pSketch->aLevelSize[j];k++) {
+      aQSketchItems[iNumItems].fVal = pSketch->aLevel[j][k];
+      aQSketchItems[iNumItems].iWeight = ((UINT32) 1) << j;
+      iNumItems++;
+    }
+  }
+
+  qsort((void *)aQSketchItems,iNumItems,sizeof(QSKETCHITEM),CompareQSketchItem);
+
+  for (j=0;j<iNumItems;j++) {
+    iRank += aQSketchItems[j].iWeight;
+    if (iRank > iPos) {
+      return(aQSketchItems[j].fVal);
+    }
+  }
+  return(aQSketchItems[iNumItems-1].fVal);
+}
+
+void StreamStatAdd(STREAMSTAT *pStream, FLOAT fVal, BOOL bFound, FLOAT fSteps) {
+
+  FLOAT fDelta;
+
+  pStream->iCount++;
+  fDelta = fVal - pStream->fMean;
+  pStream->fMean += fDelta / (FLOAT) pStream->iCount;
+  pStream->fM2 += fDelta * (fVal - pStream->fMean);
+
+  if (fVal < pStream->fMin) {
+    pStream->fMin = fVal;
+  }
+  if (fVal > pStream->fMax) {
+    pStream->fMax = fVal;
+  }
+
+  pStream->fStepSum += fSteps;
+  pStream->fStepProductSum += fSteps * fVal;
+
+  QSketchInsert(&pStream->qsAll,0,fVal);
+  pStream->qsAll.iCount++;
+
+  if (pStream->bSolveFail) {
+    if (bFound) {
+      pStream->iCountSolve++;
+      pStream->fSumSolve += fVal;
+      if (fVal < pStream->fMinSolve) {
+        pStream->fMinSolve = fVal;
+      }
+      if (fVal > pStream->fMaxSolve) {
+        pStream->fMaxSolve = fVal;
+      }
+      QSketchInsert(&pStream->qsSolve,0,fVal);
+      pStream->qsSolve.iCount++;
+    } else {
+      pStream->fSumFail += fVal;
+      if (fVal < pStream->fMinFail) {
+        pStream->fMinFail = fVal;
+      }
+      if (fVal > pStream->fMaxFail) {
+        pStream->fMaxFail = fVal;
+      }
+      QSketchInsert(&pStream->qsFail,0,fVal);
+      pStream->qsFail.iCount++;
+    }
+  }
+}
+
+void StreamStatMerge(STREAMSTAT *pDest, STREAMSTAT *pSrc) {
+
+  /* combine the results of two sets of runs (e.g.: from parallel workers) */
+
+  FLOAT fDelta;
+  UINT32 iCount;
+
+  iCount = pDest->iCount + pSrc->iCount;
+  if (iCount) {
+    fDelta = pSrc->fMean - pDest->fMean;
+    pDest->fMean += fDelta * (FLOAT) pSrc->iCount / (FLOAT) iCount;
+    pDest->fM2 += pSrc->fM2 + fDelta * fDelta * (FLOAT) pDest->iCount * (FLOAT) pSrc->iCount / (FLOAT) iCount;
+  }
+  pDest->iCount = iCount;
+
+  if (pSrc->fMin < pDest->fMin) {
+    pDest->fMin = pSrc->fMin;
+  }
+  if (pSrc->fMax > pDest->fMax) {
+    pDest->fMax = pSrc->fMax;
+  }
+  pDest->fStepSum += pSrc->fStepSum;
+  pDest->fStepProductSum += pSrc->fStepProductSum;
+  QSketchMerge(&pDest->qsAll,&pSrc->qsAll);
+
+  if ((pDest->bSolveFail) && (pSrc->bSolveFail)) {
+    pDest->iCountSolve += pSrc->iCountSolve;
+    pDest->fSumSolve += pSrc->fSumSolve;
+    pDest->fSumFail += pSrc->fSumFail;
+    if (pSrc->fMinSolve < pDest->fMinSolve) {
+      pDest->fMinSolve = pSrc->fMinSolve;
+    }
+    if (pSrc->fMaxSolve > pDest->fMaxSolve) {
+      pDest->fMaxSolve = pSrc->fMaxSolve;
+    }
+    if (pSrc->fMinFail < pDest->fMinFail) {
+      pDest->fMinFail = pSrc->fMinFail;
+    }
+    if (pSrc->fMaxFail > pDest->fMaxFail) {
+      pDest->fMaxFail = pSrc->fMaxFail;
+    }
+    QSketchMerge(&pDest->qsSolve,&pSrc->qsSolve);
+    QSketchMerge(&pDest->qsFail,&pSrc->qsFail);
+  }
+}
+
+BOOL QSketchWrite(FILE *filOut, QSKETCH *pSketch) {
+  UINT32 j;
+  if (fwrite(pSketch,sizeof(UINT32),3,filOut) != 3) {
+    return(FALSE);
+  }
+  if (fwrite(pSketch->aLevelSize,sizeof(UINT32),pSketch->iNumLevels,filOut) != pSketch->iNumLevels) {
+    return(FALSE);
+  }
+  for (j=0;j<pSketch->iNumLevels;j++) {
+    if (fwrite(pSketch->aLevel[j],sizeof(FLOAT),pSketch->aLevelSize[j],filOut) != pSketch->aLevelSize[j]) {
+      return(FALSE);
+    }
+  }
+  return(TRUE);
+}
+
+BOOL QSketchRead(FILE *filIn, QSKETCH *pSketch) {
+  UINT32 j;
+  if (fread(pSketch,sizeof(UINT32),3,filIn) != 3) {
+    return(FALSE);
+  }
+  if (pSketch->iNumLevels > QSKETCHMAXLEVELS) {
+    return(FALSE);
+  }
+  if (fread(pSketch->aLevelSize,sizeof(UINT32),pSketch->iNumLevels,filIn) != pSketch->iNumLevels) {
+    return(FALSE);
+  }
+  for (j=0;j<pSketch->iNumLevels;j++) {
+    if (pSketch->aLevelSize[j] >= QSKETCHSIZE) {
+      return(FALSE);
+    }
+    if (pSketch->aLevel[j] == NULL) {
+      pSketch->aLevel[j] = AllocateRAM(QSKETCHSIZE * sizeof(FLOAT));
+    }
+    if (fread(pSketch->aLevel[j],sizeof(FLOAT),pSketch->aLevelSize[j],filIn) != pSketch->aLevelSize[j]) {
+      return(FALSE);
+    }
+  }
+  return(TRUE);
+}
+
+BOOL StreamStatWrite(FILE *filOut, STREAMSTAT *pStream) {
+  if (fwrite(pStream,offsetof(STREAMSTAT,qsAll),1,filOut) != 1) {
+    return(FALSE);
+  }
+  if (!QSketchWrite(filOut,&pStream->qsAll)) {
+    return(FALSE);
+  }
+  if (fwrite(&pStream->bSolveFail,offsetof(STREAMSTAT,qsSolve) - offsetof(STREAMSTAT,bSolveFail),1,filOut) != 1) {
+    return(FALSE);
+  }
+  if (pStream->bSolveFail) {
+    if ((!QSketchWrite(filOut,&pStream->qsSolve)) || (!QSketchWrite(filOut,&pStream->qsFail))) {
+      return(FALSE);
+    }
+  }
+  return(TRUE);
+}
+
+BOOL StreamStatRead(FILE *filIn, STREAMSTAT *pStream) {
+  if (fread(pStream,offsetof(STREAMSTAT,qsAll),1,filIn) != 1) {
+    return(FALSE);
+  }
+  if (!QSketchRead(filIn,&pStream->qsAll)) {
+    return(FALSE);
+  }
+  if (fread(&pStream->bSolveFail,offsetof(STREAMSTAT,qsSolve) - offsetof(STREAMSTAT,bSolveFail),1,filIn) != 1) {
+    return(FALSE);
+  }
+  if (pStream->bSolveFail) {
+    if ((!QSketchRead(filIn,&pStream->qsSolve)) || (!QSketchRead(filIn,&pStream->qsFail))) {
+      return(FALSE);
+    }
+  }
+  return(TRUE);
+}
+
+void CalculateStreamStats(FLOAT *fMean, FLOAT *fStddev, FLOAT *fCV, STREAMSTAT *pStream) {
+
+  FLOAT fStddev2;
+
+  *fMean = pStream->fMean;
+  *fStddev = FLOATZERO;
+  *fCV = FLOATZERO;
+
+  if (pStream->iCount > 1) {
+    fStddev2 = pStream->fM2 / ((FLOAT) (pStream->iCount - 1));
+    if (fStddev2 > FLOATSTATSMIN) {
+      *fStddev = sqrt(fStddev2);
+      if (*fMean > FLOATSTATSMIN) {
+        *fCV = (*fStddev) / (*fMean);
+      }
+    }
+  }
+}
+
+void AllocateColumnStream() {
+
+  UINT32 j;
+  REPORTCOL *pCol;
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    pCol = &aColumns[j];
+    if (pCol->bStreamColumn) {
+      pCol->pStreamData = AllocateRAM(sizeof(STREAMSTAT));
+      InitStreamStat(pCol->pStreamData,pCol->bStreamSolveFail);
+    }
+  }
+}
+
+
 /***** Trigger ColumnInit *****/
 void ColumnInit();
 
@@ -215,11 +617,17 @@ void AddReportTriggers() {
   CreateTrigger("ReportRTDPrint",FinalReports,ReportRTDPrint,"","");
   CreateContainerTrigger("ReportRTD","ReportRTDSetup,ReportRTDPrint");
 
+  CreateTrigger("InitRTDEstimate",PreStart,InitRTDEstimate,"","");
+  CreateTrigger("UpdateRTDEstimate",RunCalculations,UpdateRTDEstimate,"","");
+  CreateContainerTrigger("RTDEstimate","InitRTDEstimate,UpdateRTDEstimate");
+
+  CreateTrigger("ReportRTDEstPrint",FinalReports,ReportRTDEstPrint,"RTDEstimate","");
+
   CreateTrigger("ReportModelPrint",FinalReports,ReportModelPrint,"","");
 
   CreateTrigger("ReportCNFStatsPrint",FinalReports,ReportCNFStatsPrint,"","");
 
-  CreateTrigger("ReportStatePrint",PostStep,ReportStatePrint,"","");
+  CreateTrigger("ReportStatePrint",PostStep,ReportStatePrint,"ImproveCount","");
   
   CreateTrigger("ReportSolutionPrint",PostRun,ReportSolutionPrint,"","");
 
@@ -237,7 +645,7 @@ void AddReportTriggers() {
 
   CreateTrigger("ReportFalseHistPrint",PostRun,ReportFalseHistPrint,"NumFalseCounts","");
 
-  CreateTrigger("ReportDistancePrint",PostStep,ReportDistancePrint,"SolutionDistance","");
+  CreateSampledTrigger("ReportDistancePrint",PostStep,ReportDistancePrint,"SolutionDistance,ImproveCount","");
 
   CreateTrigger("ReportDistHistPrint",PostRun,ReportDistHistPrint,"DistanceCounts","");
 
@@ -263,7 +671,7 @@ void AddReportTriggers() {
   CreateTrigger("ReportPenCVPrint",PostRun,ReportPenCVPrint,"PenaltyStats","");
 
   CreateTrigger("ReportMobilityPrint",PostRun,ReportMobilityPrint,"MobilityWindow","");
-  CreateTrigger("ReportMobFixedPrint",PostStep,ReportMobFixedPrint,"MobilityWindow","");
+  CreateTrigger("ReportMobFixedPrint",PostStep,ReportMobFixedPrint,"MobilityFixed","");
   CreateTrigger("ReportMobFixedFreqPrint",PostRun,ReportMobFixedFreqPrint,"MobilityFixedFrequencies","");
 
   CreateTrigger("ReportAutoCorrPrint",PostRun,ReportAutoCorrPrint,"AutoCorr","");
@@ -272,22 +680,38 @@ void AddReportTriggers() {
 
   CreateTrigger("ReportSatCompetitionPrint",FinalReports,ReportSatCompetitionPrint,"","");
 
+  CreateTrigger("ReportAnytimeSetup",PreStart,ReportAnytimeSetup,"CatchSignals","");
+  CreateTrigger("ReportAnytimeStep",PostStep,ReportAnytimeStep,"SaveBest","");
+  CreateTrigger("ReportAnytimeRun",PostRun,ReportAnytimeRun,"","");
+  CreateTrigger("ReportAnytimeFinal",FinalReports,ReportAnytimeFinal,"","");
+  CreateContainerTrigger("ReportAnytime","ReportAnytimeSetup,ReportAnytimeStep,ReportAnytimeRun,ReportAnytimeFinal");
+
+  CreateTrigger("ReportBatchSetup",PostParameters,ReportBatchSetup,"ReportFormat","");
+  CreateTrigger("ReportBatchRow",FinalReports,ReportBatchRow,"","");
+  CreateContainerTrigger("ReportBatch","ReportBatchSetup,ReportBatchRow");
+
   CreateTrigger("ActivateStepsFoundColumns",PostParameters,ActivateStepsFoundColumns,"","");
 
+  CreateTrigger("ReportFormat",PostParameters,SetupReportFormat,"","");
+
   CreateTrigger("AllocateColumnRAM",PostRead,AllocateColumnRAM,"","");
+  CreateTrigger("AllocateColumnStream",PostRead,AllocateColumnStream,"","");
 
   CreateTrigger("CalcPercentSolve",FinalCalculations,CalcPercentSolve,"","");
   CreateTrigger("CalcFPS",FinalCalculations,CalcFPS,"","");
+  CreateTrigger("CalcPeakRSS",FinalCalculations,CalcPeakRSS,"","");
+  CreateTrigger("CalcFirstFlipTime",PostInit,CalcFirstFlipTime,"","");
   CreateTrigger("StringAlgParms",FinalCalculations,StringAlgParms,"","");
   CreateTrigger("ColumnRunCalculation",PostRun,ColumnRunCalculation,"","");
   CreateTrigger("ColumnStepCalculation",StepCalculations,ColumnStepCalculation,"ColumnInit","");
+  CreateSampledTrigger("ColumnStepMeanCalculation",StepCalculations,ColumnStepMeanCalculation,"ColumnInit","");
   CreateTrigger("ColumnInit",PreRun,ColumnInit,"","");
   CreateTrigger("SolveMode",PreStart,InitSolveMode,"ReportModelPrint","");
   CreateTrigger("UpdatePercents",FinalCalculations,UpdatePercents,"SortByStepPerformance","");
 
   CreateTrigger("InitMobilityColumnN",PostParameters,InitMobilityColumnN,"","");
   CreateTrigger("InitMobilityColumnX",PostParameters,InitMobilityColumnX,"","");
-  CreateTrigger("MobilityColumn",RunCalculations,UpdateMobilityColumn,"MobilityWindow","");
+  CreateTrigger("MobilityColumn",RunCalculations,UpdateMobilityColumn,"MobilityFixed","");
 
   CreateTrigger("UpdateTimes",FinalCalculations,UpdateTimes,"SortByStepPerformance","");  
   CreateTrigger("SortByStepPerformance",FinalCalculations,SortByStepPerformance,"ActivateStepsFoundColumns","");
@@ -319,6 +743,16 @@ void ReportOutSplash() {
 void PrintColHeaders(REPORT *pRep,UINT32 iNumCols, UINT32 *aCols) {
 
   UINT32 j;
+
+  if (eReportFormat != RFormatText) {
+    RFSchemaStart(pRep);
+    for (j=0;j<iNumCols;j++) {
+      RFSchemaColumn(pRep,listColumns.aItems[aCols[j]].sID,aColumns[aCols[j]].eFinalDataType,0,aColumns[aCols[j]].sDescription);
+    }
+    RFSchemaEnd(pRep);
+    return;
+  }
+
   if (!bReportClean) {
 
     ReportHdrPrefix(pRep);
@@ -388,11 +822,50 @@ void ReportOutHeader() {
   PrintColHeaders(pRepOut,iNumOutputColumns,aOutputColumns);
 }
 
+void PrintRowFormatted(REPORT *pRep, UINT32 iRow, UINT32 iNumCols, UINT32 *aCols) {
+
+  UINT32 j;
+  REPORTCOL *pCol;
+  char *sID;
+
+  RFRecordStart(pRep,FALSE);
+
+  for (j=0;j<iNumCols;j++) {
+    pCol = &aColumns[aCols[j]];
+    sID = listColumns.aItems[aCols[j]].sID;
+
+    if (pCol->bAllocateColumnRAM) {
+      if (pCol->eFinalDataType == DTypeUInt) {
+        RFFieldUInt(pRep,sID,pCol->puiColumnData[iRow]);
+      } else if (pCol->eFinalDataType == DTypeSInt) {
+        RFFieldSInt(pRep,sID,pCol->psiColumnData[iRow]);
+      } else {
+        RFFieldFloat(pRep,sID,pCol->pfColumnData[iRow]);
+      }
+    } else {
+      if (pCol->eFinalDataType == DTypeUInt) {
+        RFFieldUInt(pRep,sID,pCol->uiCurRowValue);
+      } else if (pCol->eFinalDataType == DTypeSInt) {
+        RFFieldSInt(pRep,sID,pCol->siCurRowValue);
+      } else {
+        RFFieldFloat(pRep,sID,pCol->fCurRowValue);
+      }
+    }
+  }
+
+  RFRecordEnd(pRep);
+}
+
 void PrintRow(REPORT *pRep, UINT32 iRow, UINT32 iNumCols, UINT32 *aCols) {
 
   UINT32 j;
   REPORTCOL *pCol;
 
+  if (eReportFormat != RFormatText) {
+    PrintRowFormatted(pRep,iRow,iNumCols,aCols);
+    return;
+  }
+
   ReportPrint(pRep,"  ");
 
   for (j=0;j<iNumCols;j++) {
@@ -476,6 +949,100 @@ FLOAT GetRowElement(REPORTCOL *pCol,UINT32 iRowRequested, BOOL bSorted, BOOL bSo
   }
 }
 
+FLOAT GetSortedElement(REPORTCOL *pCol, UINT32 iPos, BOOL bSortByStep, BOOL bSolveFirst) {
+
+  /* element iPos of the sorted column (with -rstream, from the quantile sketch,
+     unless the column was kept in RAM to be sorted by step) */
+
+  STREAMSTAT *pStream;
+
+  if ((pCol->bStreamColumn) && (!((bSortByStep) && (pCol->bAllocateColumnRAM)))) {
+    pStream = pCol->pStreamData;
+    if (bSolveFirst) {
+      if (iPos < pStream->iCountSolve) {
+        if (iPos == 0) {
+          return(pStream->fMinSolve);
+        }
+        if (iPos == pStream->iCountSolve - 1) {
+          return(pStream->fMaxSolve);
+        }
+        return(QSketchElement(&pStream->qsSolve,iPos));
+      }
+      iPos -= pStream->iCountSolve;
+      if (iPos == 0) {
+        return(pStream->fMinFail);
+      }
+      if (iPos == pStream->iCount - pStream->iCountSolve - 1) {
+        return(pStream->fMaxFail);
+      }
+      return(QSketchElement(&pStream->qsFail,iPos));
+    }
+    if (iPos == 0) {
+      return(pStream->fMin);
+    }
+    if (iPos == pStream->iCount - 1) {
+      return(pStream->fMax);
+    }
+    return(QSketchElement(&pStream->qsAll,iPos));
+  }
+
+  return(GetRowElement(pCol,iPos,TRUE,bSortByStep));
+}
+
+void PrintStatValue(const char *sBaseDescription, const char *sStat, FLOAT fVal) {
+  char sName[MAXREPORTHEADERSTRING];
+  if (eReportFormat == RFormatText) {
+    ReportPrint3(pRepStats,"%s_%s = %.12g\n",sBaseDescription,sStat,fVal);
+  } else {
+    sprintf(sName,"%.*s_%s",MAXREPORTHEADERSTRING - 32,sBaseDescription,sStat);
+    RFFieldFloat(pRepStats,sName,fVal);
+  }
+}
+
+void PrintStatCustom(REPORTSTAT *pStat) {
+
+  char **pString;
+
+  if (eReportFormat != RFormatText) {
+    switch (pStat->eCustomType) {
+      case DTypeUInt:
+        RFFieldUInt(pRepStats,pStat->sBaseDescription,*(UINT32 *) pStat->pCustomValue);
+        break;
+      case DTypeSInt:
+        RFFieldSInt(pRepStats,pStat->sBaseDescription,*(SINT32 *) pStat->pCustomValue);
+        break;
+      case DTypeFloat:
+        RFFieldFloat(pRepStats,pStat->sBaseDescription,*(FLOAT *) pStat->pCustomValue);
+        break;
+      case DTypeString:
+        pString = (char **) pStat->pCustomValue;
+        RFFieldString(pRepStats,pStat->sBaseDescription,*pString);
+        break;
+    }
+    return;
+  }
+
+  ReportPrint1(pRepStats,"%s = ",pStat->sBaseDescription);
+
+  switch (pStat->eCustomType) {
+    case DTypeUInt:
+      ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(UINT32 *) pStat->pCustomValue);
+      break;
+    case DTypeSInt:
+      ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(SINT32 *) pStat->pCustomValue);
+      break;
+    case DTypeFloat:
+      ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(FLOAT *) pStat->pCustomValue);
+      break;
+    case DTypeString:
+      pString = (char **) pStat->pCustomValue;
+      ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*pString);
+      break;
+  }
+
+  ReportPrint(pRepStats,"\n");
+}
+
 void ReportStatsPrint() {
   
   UINT32 j,k,l;
@@ -497,9 +1064,11 @@ void ReportStatsPrint() {
 
   UINT32 iNumFail;
 
-  char **pString;
-
-  ReportPrint(pRepStats,"\n\n");
+  if (eReportFormat == RFormatText) {
+    ReportPrint(pRepStats,"\n\n");
+  } else {
+    RFRecordStart(pRepStats,TRUE);
+  }
 
   for (k=0;k<iNumStatsActive;k++) {
     for (j=0;j<listStats.iNumItems;j++) {
@@ -507,25 +1076,7 @@ void ReportStatsPrint() {
       if ((pStat->bActive)&&(pStat->iActiveID==k)) {
         if (pStat->bCustomField) {
 
-          ReportPrint1(pRepStats,"%s = ",pStat->sBaseDescription);
-
-          switch (pStat->eCustomType) {
-            case DTypeUInt:
-              ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(UINT32 *) pStat->pCustomValue);
-              break;
-            case DTypeSInt:
-              ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(SINT32 *) pStat->pCustomValue);
-              break;
-            case DTypeFloat:
-              ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*(FLOAT *) pStat->pCustomValue);
-              break;
-            case DTypeString:
-              pString = (char **) pStat->pCustomValue;
-              ReportPrint1(pRepStats,pStat->sPrintCustomFormat,*pString);
-              break;
-          }
-
-          ReportPrint(pRepStats,"\n");
+          PrintStatCustom(pStat);
 
         } else {
 
@@ -534,7 +1085,11 @@ void ReportStatsPrint() {
             pCol = &aColumns[FindItem(&listColumns,pStat->sDataColumn)];
 
             if (pStat->iStatFlags & STATCODE_CALCMASK) {
-              CalculateStats(&fMean, &fStdDev, &fCV, pCol->fColSum, pCol->fColSum2, iRun);
+              if (pCol->bStreamColumn) {
+                CalculateStreamStats(&fMean, &fStdDev, &fCV, pCol->pStreamData);
+              } else {
+                CalculateStats(&fMean, &fStdDev, &fCV, pCol->fColSum, pCol->fColSum2, iRun);
+              }
 
               fVar = fStdDev * fStdDev;
               fStdErr = fStdDev / (sqrt((FLOAT) iRun));            
@@ -546,227 +1101,243 @@ void ReportStatsPrint() {
               }
 
               if (pStat->iStatFlags & STATCODE_mean) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Mean",fMean);
+                PrintStatValue(pStat->sBaseDescription,"Mean",fMean);
               }
 
               if (pStat->iStatFlags & STATCODE_stddev) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"StdDev",fStdDev);
+                PrintStatValue(pStat->sBaseDescription,"StdDev",fStdDev);
               }
 
               if (pStat->iStatFlags & STATCODE_cv) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"CoeffVariance",fCV);
+                PrintStatValue(pStat->sBaseDescription,"CoeffVariance",fCV);
               }
 
               if (pStat->iStatFlags & STATCODE_var) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Variance",fVar);
+                PrintStatValue(pStat->sBaseDescription,"Variance",fVar);
               }
 
               if (pStat->iStatFlags & STATCODE_stderr) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"StdErr",fStdErr);
+                PrintStatValue(pStat->sBaseDescription,"StdErr",fStdErr);
               }
 
               if (pStat->iStatFlags & STATCODE_vmr) {
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"VarMeanRatio",fVMR);
+                PrintStatValue(pStat->sBaseDescription,"VarMeanRatio",fVMR);
               }
             }
 
             if (pStat->iStatFlags & STATCODE_sum) {
-              ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Sum",pCol->fColSum);
+              PrintStatValue(pStat->sBaseDescription,"Sum",pCol->fColSum);
             }
 
             if (pStat->iStatFlags & STATCODE_SORTMASK) {
-              if (!pStat->bSortByStep) {
+              if ((!pStat->bSortByStep) && (!pCol->bStreamColumn)) {
                 SortByCurrentColData(pCol);
               }
 
               if (pStat->iStatFlags & STATCODE_median) {
-                fMedian = GetRowElement(pCol,(iRun-1)>>1,TRUE,pStat->bSortByStep);
+                fMedian = GetSortedElement(pCol,(iRun-1)>>1,pStat->bSortByStep,FALSE);
                 if (iRun % 2 == 0) {
-                  fMedian += GetRowElement(pCol,(iRun)>>1,TRUE,pStat->bSortByStep);
+                  fMedian += GetSortedElement(pCol,(iRun)>>1,pStat->bSortByStep,FALSE);
                   fMedian /= 2.0;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Median",fMedian);
+                PrintStatValue(pStat->sBaseDescription,"Median",fMedian);
               }
 
               if (pStat->iStatFlags & STATCODE_min) {
                 iPos = 0;
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Min",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Min",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_max) {
                 iPos = iRun - 1;
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Max",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Max",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q05) {
                 iPos = (UINT32)(floor(0.05 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.05",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.05",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q10) {
                 iPos = (UINT32)(floor(0.10 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.10",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.10",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q25) {
                 iPos = (UINT32)(floor(0.25 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.25",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.25",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q75) {
                 iPos = (UINT32)(floor(0.75 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.75",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.75",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q90) {
                 iPos = (UINT32)(floor(0.90 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.90",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.90",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q95) {
                 iPos = (UINT32)(floor(0.95 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.95",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.95",fVal);
               }
               if (pStat->iStatFlags & STATCODE_q98) {
                 iPos = (UINT32)(floor(0.98 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.98",fVal);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
+                PrintStatValue(pStat->sBaseDescription,"Q.98",fVal);
               }
               if (pStat->iStatFlags & STATCODE_qr7525) {
                 iPos = (UINT32)(floor(0.75 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 iPos = (UINT32)(floor(0.25 * (FLOAT) (iRun-1)));
-                fVal2 = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal2 = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 if (fVal2 != FLOATZERO) {
                   fVal2 = fVal / fVal2;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.75/25",fVal2);
+                PrintStatValue(pStat->sBaseDescription,"Q.75/25",fVal2);
               }
               
               if (pStat->iStatFlags & STATCODE_qr9010) {
                 iPos = (UINT32)(floor(0.90 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 iPos = (UINT32)(floor(0.10 * (FLOAT) (iRun-1)));
-                fVal2 = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal2 = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 if (fVal2 != FLOATZERO) {
                   fVal2 = fVal / fVal2;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.90/10",fVal2);
+                PrintStatValue(pStat->sBaseDescription,"Q.90/10",fVal2);
               }
 
               if (pStat->iStatFlags & STATCODE_qr9505) {
                 iPos = (UINT32)(floor(0.95 * (FLOAT) (iRun-1)));
-                fVal = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 iPos = (UINT32)(floor(0.05 * (FLOAT) (iRun-1)));
-                fVal2 = GetRowElement(pCol,iPos,TRUE,pStat->bSortByStep);
+                fVal2 = GetSortedElement(pCol,iPos,pStat->bSortByStep,FALSE);
                 if (fVal2 != FLOATZERO) {
                   fVal2 = fVal / fVal2;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"Q.95/05",fVal2);
+                PrintStatValue(pStat->sBaseDescription,"Q.95/05",fVal2);
               } 
             }
             if (pStat->iStatFlags & STATCODE_SFMASK) {
-              SortByCurrentColDataAndFound(pCol);
+              if (!pCol->bStreamColumn) {
+                SortByCurrentColDataAndFound(pCol);
+              }
               iNumFail = iRun - iNumSolutionsFound;
 
               if (pStat->iStatFlags & STATCODE_stepmean) {
-                pColSteps = &aColumns[FindItem(&listColumns,"steps")];
-                fVal = FLOATZERO;
-                for (l=0;l<iRun;l++) {
-                  fVal += (GetRowElement(pColSteps,l,FALSE,FALSE) * GetRowElement(pCol,l,FALSE,FALSE));
+                if (pCol->bStreamColumn) {
+                  fVal = pCol->pStreamData->fStepProductSum;
+                  fVal2 = pCol->pStreamData->fStepSum;
+                } else {
+                  pColSteps = &aColumns[FindItem(&listColumns,"steps")];
+                  fVal = FLOATZERO;
+                  for (l=0;l<iRun;l++) {
+                    fVal += (GetRowElement(pColSteps,l,FALSE,FALSE) * GetRowElement(pCol,l,FALSE,FALSE));
+                  }
+                  fVal2 = pColSteps->fColSum;
                 }
-                if (pColSteps->fColSum != FLOATZERO) {
-                  fVal /= pColSteps->fColSum;
+                if (fVal2 != FLOATZERO) {
+                  fVal /= fVal2;
                 } else {
                   fVal = FLOATZERO;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"StepMean",fVal);
+                PrintStatValue(pStat->sBaseDescription,"StepMean",fVal);
               }
             
               if (pStat->iStatFlags & STATCODE_solvemean) {
                 fVal = FLOATZERO;
                 if (iNumSolutionsFound != 0) {
-                  for (l=0;l<iNumSolutionsFound;l++) {
-                    fVal += GetRowElement(pCol,l,TRUE,FALSE);
+                  if (pCol->bStreamColumn) {
+                    fVal = pCol->pStreamData->fSumSolve;
+                  } else {
+                    for (l=0;l<iNumSolutionsFound;l++) {
+                      fVal += GetRowElement(pCol,l,TRUE,FALSE);
+                    }
                   }
                   fVal /= iNumSolutionsFound;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"SuccessMean",fVal);
+                PrintStatValue(pStat->sBaseDescription,"SuccessMean",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_failmean) {
                 fVal = FLOATZERO;
                 if (iNumFail != 0) {
-                  for (l=iNumSolutionsFound;l<iRun;l++) {
-                    fVal += GetRowElement(pCol,l,TRUE,FALSE);
+                  if (pCol->bStreamColumn) {
+                    fVal = pCol->pStreamData->fSumFail;
+                  } else {
+                    for (l=iNumSolutionsFound;l<iRun;l++) {
+                      fVal += GetRowElement(pCol,l,TRUE,FALSE);
+                    }
                   }
                   fVal /= iNumFail;
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"FailureMean",fVal);
+                PrintStatValue(pStat->sBaseDescription,"FailureMean",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_solvemedian) {
                 if (iNumSolutionsFound == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,(iNumSolutionsFound-1)>>1,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,(iNumSolutionsFound-1)>>1,FALSE,TRUE);
                   if (iNumSolutionsFound % 2 == 0) {
-                    fVal += GetRowElement(pCol,(iNumSolutionsFound)>>1,TRUE,FALSE);
+                    fVal += GetSortedElement(pCol,(iNumSolutionsFound)>>1,FALSE,TRUE);
                     fVal /= 2.0;
                   }
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"SuccessMedian",fVal);
+                PrintStatValue(pStat->sBaseDescription,"SuccessMedian",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_failmedian) {
                 if (iNumFail == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,((iNumFail-1)>>1) + iNumSolutionsFound,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,((iNumFail-1)>>1) + iNumSolutionsFound,FALSE,TRUE);
                   if (iNumFail % 2 == 0) {
-                    fVal += GetRowElement(pCol,((iNumFail)>>1) + iNumSolutionsFound,TRUE,FALSE);
+                    fVal += GetSortedElement(pCol,((iNumFail)>>1) + iNumSolutionsFound,FALSE,TRUE);
                     fVal /= 2.0;
                   }
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"FailureMedian",fVal);
+                PrintStatValue(pStat->sBaseDescription,"FailureMedian",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_solvemin) {
                 if (iNumSolutionsFound == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,0,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,0,FALSE,TRUE);
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"SuccessMin",fVal);
+                PrintStatValue(pStat->sBaseDescription,"SuccessMin",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_failmin) {
                 if (iNumFail == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,iNumSolutionsFound,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,iNumSolutionsFound,FALSE,TRUE);
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"FailureMin",fVal);
+                PrintStatValue(pStat->sBaseDescription,"FailureMin",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_solvemax) {
                 if (iNumSolutionsFound == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,iNumSolutionsFound-1,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,iNumSolutionsFound-1,FALSE,TRUE);
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"SuccessMax",fVal);
+                PrintStatValue(pStat->sBaseDescription,"SuccessMax",fVal);
               }
 
               if (pStat->iStatFlags & STATCODE_failmax) {
                 if (iNumFail == 0) {
                   fVal = FLOATZERO;
                 } else {
-                  fVal = GetRowElement(pCol,iRun-1,TRUE,FALSE);
+                  fVal = GetSortedElement(pCol,iRun-1,FALSE,TRUE);
                 }
-                ReportPrint3(pRepStats,"%s_%s = %.12g\n",pStat->sBaseDescription,"FailureMax",fVal);
+                PrintStatValue(pStat->sBaseDescription,"FailureMax",fVal);
               }
             }
           }
@@ -774,7 +1345,11 @@ void ReportStatsPrint() {
       }
     }
   }
-  ReportPrint(pRepStats,"\n\n");
+  if (eReportFormat == RFormatText) {
+    ReportPrint(pRepStats,"\n\n");
+  } else {
+    RFRecordEnd(pRepStats);
+  }
 }
 
 
@@ -791,11 +1366,302 @@ void PrintRTDRow(UINT32 iRow) {
   PrintRow(pRepRTD,aSortedByStepsAndFound[iRow],iNumRTDColumns,aRTDColumns);
 }
 
-void ReportRTDPrint() {
-  UINT32 j;
-  PrintColHeaders(pRepRTD,iNumRTDColumns,aRTDColumns);
-  for (j=0;j<iNumSolutionsFound;j++) {
-    PrintRTDRow(j);
+void ReportRTDPrint() {
+  UINT32 j;
+  PrintColHeaders(pRepRTD,iNumRTDColumns,aRTDColumns);
+  for (j=0;j<iNumSolutionsFound;j++) {
+    PrintRTDRow(j);
+  }
+}
+
+
+
+/***** Trigger RTDEstimate *****/
+
+/*
+    The run-length (and run-time) distribution is estimated with the
+    Kaplan-Meier (product-limit) estimator: an unsuccessful run is censored
+    at the step (and time) it stopped, which is iCutoff unless it was
+    stopped early (i.e.: -timeout).
+
+    The bounds are 95% bounds from Greenwood's variance, and the bounds of
+    the median are where the bounds of the survival curve cross 1/2.
+
+    The relative error of the estimate is the larger half-width of the
+    bounds of the median steps (relative to the median), or of the success
+    probability when no median has been reached yet.
+
+    Each run is appended in O(1), and the runs are only sorted and the
+    estimate recalculated when it is needed: with -rtdprecision, once
+    every n / RTDESTCALCFRAC runs (so the runs stop at most ~3% later than
+    if it was checked after every run), and otherwise only for the report.
+*/
+
+void InitRTDEstimate() {
+
+  if (fRTDPrecision < FLOATZERO) {
+    ReportPrint1(pRepErr,"Error: -rtdprecision must be >= 0 (not %.6g)\n",fRTDPrecision);
+    AbnormalExit();
+  }
+
+  iNumRTDEst = 0;
+  iMaxRTDEst = 0;
+  iNumRTDEstCalc = 0;
+  iNextRTDEstCalc = RTDESTMINRUNS;
+  bRTDEstStopped = FALSE;
+
+  fRTDEstProb = FLOATZERO;
+  fRTDEstProbLow = FLOATZERO;
+  fRTDEstProbHigh = 1.0;
+  fRTDEstSteps = FLOATMAX;
+  fRTDEstStepsLow = FLOATMAX;
+  fRTDEstStepsHigh = FLOATMAX;
+  fRTDEstTime = FLOATMAX;
+  fRTDEstTimeLow = FLOATMAX;
+  fRTDEstTimeHigh = FLOATMAX;
+  fRTDEstError = FLOATMAX;
+}
+
+void GrowRTDEstimate() {
+  UINT32 iNewMax;
+  RTDESTITEM *aNewSteps;
+  RTDESTITEM *aNewTimes;
+
+  /* -runs can be (much) larger than the # of runs that are needed */
+
+  if (iMaxRTDEst == 0) {
+    iNewMax = RTDESTINITRUNS;
+  } else {
+    iNewMax = iMaxRTDEst * 2;
+  }
+  if (iNewMax > iNumRuns) {
+    iNewMax = iNumRuns;
+  }
+
+  aNewSteps = AllocateRAM(iNewMax * sizeof(RTDESTITEM));
+  aNewTimes = AllocateRAM(iNewMax * sizeof(RTDESTITEM));
+
+  if (iNumRTDEst) {
+    memcpy(aNewSteps,aRTDEstSteps,iNumRTDEst * sizeof(RTDESTITEM));
+    memcpy(aNewTimes,aRTDEstTimes,iNumRTDEst * sizeof(RTDESTITEM));
+  }
+
+  aRTDEstSteps = aNewSteps;
+  aRTDEstTimes = aNewTimes;
+  iMaxRTDEst = iNewMax;
+}
+
+int CompareRTDEstItem(const void *a, const void *b) {
+
+  /* sorted by value, with the successful runs before the censored runs of the same value */
+
+  const RTDESTITEM *pA = (const RTDESTITEM *) a;
+  const RTDESTITEM *pB = (const RTDESTITEM *) b;
+
+  if (pA->fVal < pB->fVal) {
+    return(-1);
+  } else if (pA->fVal > pB->fVal) {
+    return(1);
+  }
+  if ((pA->bFound) && (!pB->bFound)) {
+    return(-1);
+  } else if ((!pA->bFound) && (pB->bFound)) {
+    return(1);
+  }
+  return(0);
+}
+
+FLOAT RTDEstClip(FLOAT fProb) {
+  if (fProb < FLOATZERO) {
+    return(FLOATZERO);
+  }
+  if (fProb > 1.0) {
+    return(1.0);
+  }
+  return(fProb);
+}
+
+FLOAT CalcRTDEstimate(RTDESTITEM *aItems, FLOAT *pMedian, FLOAT *pLow, FLOAT *pHigh, FLOAT *pStdErr, REPORT *pRepCurve) {
+  UINT32 j;
+  UINT32 k;
+  UINT32 iAtRisk;
+  UINT32 iNumEvents;
+  FLOAT fSurvival;
+  FLOAT fGreenwood;
+  FLOAT fStdErr;
+
+  *pMedian = FLOATMAX;
+  *pLow = FLOATMAX;
+  *pHigh = FLOATMAX;
+
+  iAtRisk = iNumRTDEst;
+  fSurvival = 1.0;
+  fGreenwood = FLOATZERO;
+  fStdErr = FLOATZERO;
+
+  j = 0;
+  while (j < iNumRTDEst) {
+    iNumEvents = 0;
+    for (k=j;(k < iNumRTDEst) && (aItems[k].fVal == aItems[j].fVal);k++) {
+      if (aItems[k].bFound) {
+        iNumEvents++;
+      }
+    }
+    if (iNumEvents) {
+      fSurvival *= 1.0 - (FLOAT) iNumEvents / (FLOAT) iAtRisk;
+      if (iAtRisk > iNumEvents) {
+        fGreenwood += (FLOAT) iNumEvents / ((FLOAT) iAtRisk * (FLOAT) (iAtRisk - iNumEvents));
+      }
+      fStdErr = fSurvival * sqrt(fGreenwood);
+
+      if ((*pLow == FLOATMAX) && (fSurvival - RTDESTZ * fStdErr <= 0.5)) {
+        *pLow = aItems[j].fVal;
+      }
+      if ((*pMedian == FLOATMAX) && (fSurvival <= 0.5)) {
+        *pMedian = aItems[j].fVal;
+      }
+      if ((*pHigh == FLOATMAX) && (fSurvival + RTDESTZ * fStdErr <= 0.5)) {
+        *pHigh = aItems[j].fVal;
+      }
+
+      if (pRepCurve) {
+        ReportPrint2(pRepCurve,"%.12g %.6g ",aItems[j].fVal,1.0 - fSurvival);
+        ReportPrint2(pRepCurve,"%.6g %.6g\n",RTDEstClip(1.0 - fSurvival - RTDESTZ * fStdErr),RTDEstClip(1.0 - fSurvival + RTDESTZ * fStdErr));
+      }
+    }
+    iAtRisk -= (k - j);
+    j = k;
+  }
+
+  *pStdErr = fStdErr;
+  return(fSurvival);
+}
+
+void CalcRTDEstimates() {
+  FLOAT fSurvival;
+  FLOAT fStdErr;
+  FLOAT fTimeStdErr;
+
+  /* the runs appended since the last calculation are unsorted (qsort is O(n log n) on the mostly sorted arrays) */
+
+  qsort((void *)aRTDEstSteps,iNumRTDEst,sizeof(RTDESTITEM),CompareRTDEstItem);
+  qsort((void *)aRTDEstTimes,iNumRTDEst,sizeof(RTDESTITEM),CompareRTDEstItem);
+  iNumRTDEstCalc = iNumRTDEst;
+
+  fSurvival = CalcRTDEstimate(aRTDEstSteps,&fRTDEstSteps,&fRTDEstStepsLow,&fRTDEstStepsHigh,&fStdErr,NULL);
+  CalcRTDEstimate(aRTDEstTimes,&fRTDEstTime,&fRTDEstTimeLow,&fRTDEstTimeHigh,&fTimeStdErr,NULL);
+
+  fRTDEstProb = 1.0 - fSurvival;
+  fRTDEstProbLow = RTDEstClip(fRTDEstProb - RTDESTZ * fStdErr);
+  fRTDEstProbHigh = RTDEstClip(fRTDEstProb + RTDESTZ * fStdErr);
+
+  if (fRTDEstSteps != FLOATMAX) {
+    if (fRTDEstStepsHigh != FLOATMAX) {
+      fRTDEstError = (fRTDEstStepsHigh - fRTDEstSteps) / fRTDEstSteps;
+      if ((fRTDEstSteps - fRTDEstStepsLow) / fRTDEstSteps > fRTDEstError) {
+        fRTDEstError = (fRTDEstSteps - fRTDEstStepsLow) / fRTDEstSteps;
+      }
+    } else {
+      fRTDEstError = FLOATMAX;
+    }
+  } else {
+    if (fRTDEstProb > FLOATZERO) {
+      fRTDEstError = RTDESTZ * fStdErr / fRTDEstProb;
+    } else {
+      fRTDEstError = FLOATMAX;
+    }
+  }
+}
+
+void UpdateRTDEstimate() {
+
+  if (iNumRTDEst == iMaxRTDEst) {
+    GrowRTDEstimate();
+  }
+
+  aRTDEstSteps[iNumRTDEst].fVal = (FLOAT) iStep;
+  aRTDEstSteps[iNumRTDEst].bFound = bSolutionFound;
+  aRTDEstTimes[iNumRTDEst].fVal = fRunTime;
+  aRTDEstTimes[iNumRTDEst].bFound = bSolutionFound;
+  iNumRTDEst++;
+
+  if ((fRTDPrecision > FLOATZERO) && (iNumRTDEst >= iNextRTDEstCalc)) {
+    CalcRTDEstimates();
+    iNextRTDEstCalc = iNumRTDEst + 1 + iNumRTDEst / RTDESTCALCFRAC;
+    if (fRTDEstError <= fRTDPrecision) {
+      bRTDEstStopped = TRUE;
+      bTerminateAllRuns = TRUE;
+    }
+  }
+}
+
+
+
+/***** Report -r rtdest *****/
+
+void ReportRTDEstValue(const char *sFormat, FLOAT fVal) {
+  if (fVal == FLOATMAX) {
+    ReportPrint(pRepRTDEst,"inf");
+  } else {
+    ReportPrint1(pRepRTDEst,sFormat,fVal);
+  }
+}
+
+void ReportRTDEstLine(const char *sName, FLOAT fVal, FLOAT fLow, FLOAT fHigh) {
+  ReportPrint1(pRepRTDEst,"%s = ",sName);
+  ReportRTDEstValue("%.12g",fVal);
+  ReportPrint(pRepRTDEst," [");
+  ReportRTDEstValue("%.12g",fLow);
+  ReportPrint(pRepRTDEst,", ");
+  ReportRTDEstValue("%.12g",fHigh);
+  ReportPrint(pRepRTDEst,"]\n");
+}
+
+void ReportRTDEstPrint() {
+  UINT32 j;
+  UINT32 iNumFound;
+  FLOAT fMedian;
+  FLOAT fLow;
+  FLOAT fHigh;
+  FLOAT fStdErr;
+
+  if (iNumRTDEstCalc != iNumRTDEst) {
+    CalcRTDEstimates();
+  }
+
+  iNumFound = 0;
+  for (j=0;j<iNumRTDEst;j++) {
+    if (aRTDEstSteps[j].bFound) {
+      iNumFound++;
+    }
+  }
+
+  ReportHdrPrefix(pRepRTDEst);
+  ReportHdrPrint(pRepRTDEst," Kaplan-Meier estimate of the run-length distribution (unsuccessful runs are censored)\n");
+  ReportHdrPrefix(pRepRTDEst);
+  ReportHdrPrint(pRepRTDEst," estimate [95%% lower bound, upper bound] -- inf if the bound is not reached yet\n");
+  ReportHdrPrefix(pRepRTDEst);
+  ReportHdrPrint(pRepRTDEst,"\n");
+
+  ReportPrint1(pRepRTDEst,"EstRuns = %u\n",iNumRTDEst);
+  ReportPrint1(pRepRTDEst,"EstSuccessfulRuns = %u\n",iNumFound);
+  ReportPrint1(pRepRTDEst,"EstCensoredRuns = %u\n",iNumRTDEst - iNumFound);
+  ReportRTDEstLine("EstSuccessProb",fRTDEstProb,fRTDEstProbLow,fRTDEstProbHigh);
+  ReportRTDEstLine("EstMedianSteps",fRTDEstSteps,fRTDEstStepsLow,fRTDEstStepsHigh);
+  ReportRTDEstLine("EstMedianTime",fRTDEstTime,fRTDEstTimeLow,fRTDEstTimeHigh);
+  ReportPrint(pRepRTDEst,"EstRelativeError = ");
+  ReportRTDEstValue("%.6g",fRTDEstError);
+  ReportPrint(pRepRTDEst,"\n");
+  if (fRTDPrecision > FLOATZERO) {
+    ReportPrint2(pRepRTDEst,"EstPrecisionReached = %u (-rtdprecision %.6g)\n",bRTDEstStopped,fRTDPrecision);
+  }
+
+  if (bReportRTDEstCurve) {
+    ReportHdrPrefix(pRepRTDEst);
+    ReportHdrPrint(pRepRTDEst,"\n");
+    ReportHdrPrefix(pRepRTDEst);
+    ReportHdrPrint(pRepRTDEst," Steps | Est. P(solved) | 95%% lower bound | 95%% upper bound\n");
+    CalcRTDEstimate(aRTDEstSteps,&fMedian,&fLow,&fHigh,&fStdErr,pRepRTDEst);
   }
 }
 
@@ -854,6 +1720,22 @@ void ReportModelPrint() {
 
 /***** Report -r cnfstats *****/
 
+void PrintCNFStatUInt(const char *sName, const char *sFormat, UINT32 iVal) {
+  if (eReportFormat == RFormatText) {
+    ReportPrint1(pRepCNFStats,sFormat,iVal);
+  } else {
+    RFFieldUInt(pRepCNFStats,sName,iVal);
+  }
+}
+
+void PrintCNFStatFloat(const char *sName, const char *sFormat, FLOAT fVal) {
+  if (eReportFormat == RFormatText) {
+    ReportPrint1(pRepCNFStats,sFormat,fVal);
+  } else {
+    RFFieldFloat(pRepCNFStats,sName,fVal);
+  }
+}
+
 void ReportCNFStatsPrint() {
 
   UINT32 j;
@@ -868,10 +1750,14 @@ void ReportCNFStatsPrint() {
 
   UINT32 *aClauseBins;
   
+  if (eReportFormat != RFormatText) {
+    RFRecordStart(pRepCNFStats,TRUE);
+  }
+
 
-  ReportPrint1(pRepCNFStats,"Clauses = %u\n",iNumClauses);
-  ReportPrint1(pRepCNFStats,"Variables = %u \n",iNumVars);
-  ReportPrint1(pRepCNFStats,"TotalLiterals = %u\n",iNumLits);
+  PrintCNFStatUInt("Clauses","Clauses = %u\n",iNumClauses);
+  PrintCNFStatUInt("Variables","Variables = %u \n",iNumVars);
+  PrintCNFStatUInt("TotalLiterals","TotalLiterals = %u\n",iNumLits);
 
   iMaxClauseLen = 0;
   for (j=0;j<iNumClauses;j++) {
@@ -879,7 +1765,7 @@ void ReportCNFStatsPrint() {
       iMaxClauseLen = aClauseLen[j];
     }
   }
-  ReportPrint1(pRepCNFStats,"MaxClauseLen = %u\n",iMaxClauseLen);
+  PrintCNFStatUInt("MaxClauseLen","MaxClauseLen = %u\n",iMaxClauseLen);
 
   if (iNumClauses > 0) {
 
@@ -893,24 +1779,28 @@ void ReportCNFStatsPrint() {
       aClauseBins[aClauseLen[j]]++;
     }
 
-    ReportPrint1(pRepCNFStats,"NumClauseLen1 = %u \n",aClauseBins[1]);
-    ReportPrint1(pRepCNFStats,"NumClauseLen2 =  %u \n",aClauseBins[2]);
-    ReportPrint1(pRepCNFStats,"NumClauseLen3+ = %u \n",iNumClauses - aClauseBins[1] - aClauseBins[2]);
+    PrintCNFStatUInt("NumClauseLen1","NumClauseLen1 = %u \n",aClauseBins[1]);
+    PrintCNFStatUInt("NumClauseLen2","NumClauseLen2 =  %u \n",aClauseBins[2]);
+    PrintCNFStatUInt("NumClauseLen3+","NumClauseLen3+ = %u \n",iNumClauses - aClauseBins[1] - aClauseBins[2]);
 
-    ReportPrint(pRepCNFStats,"FullClauseDistribution = ");
-    for (j=0;j<=iMaxClauseLen;j++) {
-      if (aClauseBins[j] > 0) {
-        ReportPrint1(pRepCNFStats," %u",j);
-        ReportPrint1(pRepCNFStats,":%u",aClauseBins[j]);
+    if (eReportFormat == RFormatText) {
+      ReportPrint(pRepCNFStats,"FullClauseDistribution = ");
+      for (j=0;j<=iMaxClauseLen;j++) {
+        if (aClauseBins[j] > 0) {
+          ReportPrint1(pRepCNFStats," %u",j);
+          ReportPrint1(pRepCNFStats,":%u",aClauseBins[j]);
+        }
       }
+      ReportPrint(pRepCNFStats,"\n");
+    } else {
+      RFFieldUIntArray(pRepCNFStats,"FullClauseDistribution",iMaxClauseLen + 1,aClauseBins);
     }
-    ReportPrint(pRepCNFStats,"\n");
 
     fAvgLitClause = (FLOAT)iNumLits / (FLOAT) iNumClauses;
-    ReportPrint1(pRepCNFStats,"MeanClauseLen = %.12g \n",fAvgLitClause);
+    PrintCNFStatFloat("MeanClauseLen","MeanClauseLen = %.12g \n",fAvgLitClause);
     
     fAvgVarOccur = (FLOAT) iNumLits / (FLOAT) iNumVars;
-    ReportPrint1(pRepCNFStats,"MeanVariableOcc = %.12g \n",fAvgVarOccur);
+    PrintCNFStatFloat("MeanVariableOcc","MeanVariableOcc = %.12g \n",fAvgVarOccur);
 
     fStdDevVarOccur = FLOATZERO; 
     for (j=1;j<=iNumVars;j++) {
@@ -920,7 +1810,7 @@ void ReportCNFStatsPrint() {
     fStdDevVarOccur /= (FLOAT) (iNumVars-1);
     fStdDevVarOccur = sqrt(fStdDevVarOccur);
     
-    ReportPrint1(pRepCNFStats,"StdDevVariableOcc = %.12g \n",fStdDevVarOccur);
+    PrintCNFStatFloat("StdDevVariableOcc","StdDevVariableOcc = %.12g \n",fStdDevVarOccur);
 
     iNumPos = 0;
     iNumNeg = 0;
@@ -929,9 +1819,13 @@ void ReportCNFStatsPrint() {
       iNumNeg += aNumLitOcc[GetNegLit(j)];
     }
     fPosNegRatio = (FLOAT) iNumPos / (FLOAT) iNumNeg;
-    ReportPrint1(pRepCNFStats,"NumPosLit = %u \n",iNumPos);
-    ReportPrint1(pRepCNFStats,"NumNegLit = %u \n",iNumNeg);
-    ReportPrint1(pRepCNFStats,"RatioPos:NegLit = %.12g \n",fPosNegRatio);
+    PrintCNFStatUInt("NumPosLit","NumPosLit = %u \n",iNumPos);
+    PrintCNFStatUInt("NumNegLit","NumNegLit = %u \n",iNumNeg);
+    PrintCNFStatFloat("RatioPos:NegLit","RatioPos:NegLit = %.12g \n",fPosNegRatio);
+  }
+
+  if (eReportFormat != RFormatText) {
+    RFRecordEnd(pRepCNFStats);
   }
 }
 
@@ -1019,6 +1913,7 @@ void ReportBestSolPrint() {
   } else {
     ReportPrint1(pRepBestSol,"%u ",iBestNumFalse);
   }
+  MaterializeSaveBest();
   for (j=1;j<=iNumVars;j++) {
     if (GetVarStateBit(vsBest,j-1)) {
       ReportPrint(pRepBestSol,"1");
@@ -1192,12 +2087,29 @@ void ReportUnsatClausesPrint() {
 
 void ReportFalseHistPrint() {
   UINT32 j;
+  if (eReportFormat != RFormatText) {
+    if (iRun==1) {
+      RFSchemaStart(pRepFalseHist);
+      RFSchemaColumn(pRepFalseHist,"run",DTypeUInt,0,"Run ID");
+      RFSchemaColumn(pRepFalseHist,"numfalse",DTypeUInt,iNumClauses+1,"# times where numfalse = 0, 1, 2, ...");
+      RFSchemaEnd(pRepFalseHist);
+    }
+    RFRecordStart(pRepFalseHist,FALSE);
+    RFFieldUInt(pRepFalseHist,"run",iRun);
+    RFFieldUIntArray(pRepFalseHist,"numfalse",iNumClauses+1,aNumFalseCounts);
+    RFRecordEnd(pRepFalseHist);
+    return;
+  }
   if (iRun==1) {
     ReportHdrPrefix(pRepFalseHist);
     ReportHdrPrint(pRepFalseHist," Run ID | # times where numfalse = 0 | 1 | 2 | ....\n");
     if (iReportFalseHistCount) {
       ReportHdrPrefix(pRepFalseHist);
-      ReportHdrPrint1(pRepFalseHist,"Note: For the last %u steps of the search\n",iReportFalseHistCount);
+      ReportHdrPrint2(pRepFalseHist,"Note: For the last %u %s of the search\n",iReportFalseHistCount,bStatSample ? "samples" : "steps");
+    }
+    if (bStatSample) {
+      ReportHdrPrefix(pRepFalseHist);
+      ReportHdrPrint1(pRepFalseHist,"Note: Counts are of the sampled steps only (-statsample %.6g)\n",fStatSample);
     }
   }
   ReportPrint1(pRepFalseHist,"%u ",iRun);
@@ -1253,7 +2165,11 @@ void ReportDistHistPrint() {
     ReportHdrPrint(pRepDistHist," Run ID | # times where hamming distance to solution(s) = 0 | 1 | 2 | ....\n");
     if (iReportDistHistCount) {
       ReportHdrPrefix(pRepDistHist);
-      ReportHdrPrint1(pRepDistHist,"For the last %u steps of the search\n",iReportDistHistCount);
+      ReportHdrPrint2(pRepDistHist,"For the last %u %s of the search\n",iReportDistHistCount,bStatSample ? "samples" : "steps");
+    }
+    if (bStatSample) {
+      ReportHdrPrefix(pRepDistHist);
+      ReportHdrPrint1(pRepDistHist,"Note: Counts are of the sampled steps only (-statsample %.6g)\n",fStatSample);
     }
   }
   ReportPrint1(pRepDistHist,"%u ",iRun);
@@ -1760,7 +2676,11 @@ void ReportMobilityPrint() {
 
   ReportPrint1(pRepMobility,"%u",iRun);
   for (j=1;j<=iReportMobilityDisplay;j++) {
-    fMean = aMobilityWindowSum[j] / (iStep - j);
+    if (aMobilityWindowCount[j]) {
+      fMean = aMobilityWindowSum[j] / (FLOAT) aMobilityWindowCount[j];
+    } else {
+      fMean = FLOATZERO;
+    }
     if (bReportMobilityNormalized) {
       if (j <= iNumVars) {
         fMean /= (FLOAT) j;
@@ -1786,10 +2706,10 @@ void ReportMobFixedPrint() {
 
   if (iStep <= iMobFixedWindow) {
     if (bMobilityFixedIncludeStart) {
-      ReportPrint3(pRepMobFixed,"%u %u %u\n",iRun,iStep,aMobilityWindow[iStep-1]);
+      ReportPrint3(pRepMobFixed,"%u %u %u\n",iRun,iStep,iMobilityFixed);
     }
   } else {
-    ReportPrint3(pRepMobFixed,"%u %u %u\n",iRun,iStep,aMobilityWindow[iMobFixedWindow]);
+    ReportPrint3(pRepMobFixed,"%u %u %u\n",iRun,iStep,iMobilityFixed);
   }
 }
 
@@ -1981,6 +2901,242 @@ void ReportSatCompetitionPrint() {
 
 
 
+/***** Report -r anytime *****/
+
+void ReportAnytimeSetup() {
+
+  iAnytimeBest = UINT32MAX;
+  fAnytimeBestW = FLOATMAX;
+  bAnytimeFound = FALSE;
+  bAnytimePending = FALSE;
+  fAnytimeLastPrint = FLOATZERO;
+
+  vsAnytime = NewVarState();
+
+  ReportHdrPrefix(pRepAnytime);
+  ReportHdrPrint(pRepAnytime," o lines are printed for each new best solution quality found in any run\n");
+}
+
+void ReportAnytimePrintModel() {
+  UINT32 j;
+  ReportPrint(pRepAnytime,"v");
+  for (j=1;j<=iNumVars;j++) {
+    if (GetVarStateBit(vsAnytime,j-1)) {
+      ReportPrint1(pRepAnytime," %u",j);
+    } else {
+      ReportPrint1(pRepAnytime," -%u",j);
+    }
+  }
+  ReportPrint(pRepAnytime,"\n");
+}
+
+void ReportAnytimeEmit() {
+
+  /* vsBest always holds the pending model: the pending flag is only set
+     when the current run's best is also the best across all runs */
+
+  MaterializeSaveBest();
+  memcpy(vsAnytime,vsBest,iVARSTATELen);
+  bAnytimeFound = TRUE;
+  bAnytimePending = FALSE;
+
+  if (bWeighted) {
+    ReportPrint1(pRepAnytime,"o %.12g\n",fAnytimeBestW);
+  } else {
+    ReportPrint1(pRepAnytime,"o %u\n",iAnytimeBest);
+  }
+  if (iReportAnytimeModel == 2) {
+    ReportAnytimePrintModel();
+  }
+  if (pRepAnytime->fileOut) {
+    fflush(pRepAnytime->fileOut);
+  }
+  fAnytimeLastPrint = TotalTimeElapsed();
+}
+
+void ReportAnytimeStep() {
+
+  if (bWeighted) {
+    if ((iBestStepSumFalseW == iStep) && (fBestSumFalseW < fAnytimeBestW)) {
+      fAnytimeBestW = fBestSumFalseW;
+      bAnytimePending = TRUE;
+    }
+  } else {
+    if ((iBestStepNumFalse == iStep) && (iBestNumFalse < iAnytimeBest)) {
+      iAnytimeBest = iBestNumFalse;
+      bAnytimePending = TRUE;
+    }
+  }
+
+  /* only look at the clock every few steps, so a burst of improvements
+     costs nothing more than a flag update */
+
+  if ((bAnytimePending) && ((iStep & ANYTIMECLOCKMASK) == 0)) {
+    if ((TotalTimeElapsed() - fAnytimeLastPrint) >= fReportAnytimeInterval) {
+      ReportAnytimeEmit();
+    }
+  }
+}
+
+void ReportAnytimeRun() {
+  if (bAnytimePending) {
+    ReportAnytimeEmit();
+  }
+}
+
+void ReportAnytimeFinal() {
+  if (bAnytimeFound) {
+    if (((bWeighted) && (fAnytimeBestW == FLOATZERO)) || ((!bWeighted) && (iAnytimeBest == 0))) {
+      ReportPrint(pRepAnytime,"s OPTIMUM FOUND\n");
+    } else {
+      ReportPrint(pRepAnytime,"s UNKNOWN\n");
+    }
+    if (iReportAnytimeModel) {
+      ReportAnytimePrintModel();
+    }
+  } else {
+    ReportPrint(pRepAnytime,"s UNKNOWN\n");
+  }
+  if (pRepAnytime->fileOut) {
+    fflush(pRepAnytime->fileOut);
+  }
+}
+
+
+
+/***** Report -r batch *****/
+
+void ResetReportData() {
+
+  /* (batch mode) the RAM of the last instance has been released */
+
+  UINT32 j;
+
+  for (j=0;j<listColumns.iNumItems;j++) {
+    aColumns[j].fColSum = FLOATZERO;
+    aColumns[j].fColSum2 = FLOATZERO;
+  }
+
+  aQSketchItems = NULL;
+  aSortedByCurrent = NULL;
+  aSortedBySteps = NULL;
+  aSortedByStepsAndFound = NULL;
+  bSortedByStepsValid = FALSE;
+}
+
+void AddBatchColumnID(UINT32 j, const char *sItem) {
+  NOREF(sItem);
+  aBatchColumns[iNumBatchColumns++] = j;
+}
+
+void ReportBatchSetup() {
+
+  UINT32 j;
+
+  iNumBatchColumns = 0;
+  ParseItemList(&listColumns,(char *)pRepBatch->aParameters[0],ActivateColumnID);
+  ParseItemList(&listColumns,(char *)pRepBatch->aParameters[0],AddBatchColumnID);
+
+  if (eReportFormat != RFormatText) {
+    RFSchemaStart(pRepBatch);
+    RFSchemaColumn(pRepBatch,"instance",DTypeString,0,"Instance File Name");
+    RFSchemaColumn(pRepBatch,"runs",DTypeUInt,0,"Number of Runs");
+    RFSchemaColumn(pRepBatch,"solved",DTypeUInt,0,"Number of Successful Runs");
+    RFSchemaColumn(pRepBatch,"totaltime",DTypeFloat,0,"Total Time in seconds");
+    for (j=0;j<iNumBatchColumns;j++) {
+      RFSchemaColumn(pRepBatch,listColumns.aItems[aBatchColumns[j]].sID,DTypeFloat,0,aColumns[aBatchColumns[j]].sDescription);
+    }
+    RFSchemaEnd(pRepBatch);
+    return;
+  }
+
+  PrintUBCSATHeader(pRepBatch);
+
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint1(pRepBatch," -alg %s",pActiveAlgorithm->sName);
+  if (*(pActiveAlgorithm->sVariant)) {
+    ReportHdrPrint1(pRepBatch," -v %s",pActiveAlgorithm->sVariant);
+  }
+  if (pActiveAlgorithm->bWeighted) {
+    ReportHdrPrint(pRepBatch," -w");
+  }
+  ReportHdrPrint(pRepBatch,"\n");
+
+  PrintAlgParmSettings(pRepBatch,&parmUBCSAT);
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"\n");
+  PrintAlgParmSettings(pRepBatch,&pActiveAlgorithm->parmList);
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"\n");
+
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"Batch Columns: |runs|solved|totaltime");
+  for (j=0;j<iNumBatchColumns;j++) {
+    ReportHdrPrint1(pRepBatch,"|%s",listColumns.aItems[aBatchColumns[j]].sID);
+  }
+  ReportHdrPrint(pRepBatch,"|instance|\n");
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"\n");
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"runs: Number of Runs\n");
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"solved: Number of Successful Runs\n");
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"totaltime: Total Time in seconds\n");
+  for (j=0;j<iNumBatchColumns;j++) {
+    ReportHdrPrefix(pRepBatch);
+    ReportHdrPrint2(pRepBatch,"%s: Mean of: %s\n",listColumns.aItems[aBatchColumns[j]].sID,aColumns[aBatchColumns[j]].sDescription);
+  }
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"instance: Instance File Name\n");
+  ReportHdrPrefix(pRepBatch);
+  ReportHdrPrint(pRepBatch,"\n");
+}
+
+void ReportBatchRow() {
+
+  UINT32 j;
+  REPORTCOL *pCol;
+  FLOAT fMean;
+  FLOAT fStddev;
+  FLOAT fCV;
+
+  if (eReportFormat != RFormatText) {
+    RFRecordStart(pRepBatch,FALSE);
+    RFFieldString(pRepBatch,"instance",sFilenameIn);
+    RFFieldUInt(pRepBatch,"runs",iRun);
+    RFFieldUInt(pRepBatch,"solved",iNumSolutionsFound);
+    RFFieldFloat(pRepBatch,"totaltime",fTotalTime);
+  } else {
+    ReportPrint3(pRepBatch,"  %5u %6u %10.6f",iRun,iNumSolutionsFound,fTotalTime);
+  }
+
+  for (j=0;j<iNumBatchColumns;j++) {
+    pCol = &aColumns[aBatchColumns[j]];
+    CalculateStats(&fMean,&fStddev,&fCV,pCol->fColSum,pCol->fColSum2,iRun);
+    if (eReportFormat != RFormatText) {
+      RFFieldFloat(pRepBatch,listColumns.aItems[aBatchColumns[j]].sID,fMean);
+    } else {
+      ReportPrint1(pRepBatch," %12.6g",fMean);
+    }
+  }
+
+  if (eReportFormat != RFormatText) {
+    RFRecordEnd(pRepBatch);
+    RFFlush();
+  } else {
+    ReportPrint1(pRepBatch," %s\n",sFilenameIn);
+  }
+
+  /* each row is written out as soon as the instance is done */
+
+  if (pRepBatch->fileOut) {
+    fflush(pRepBatch->fileOut);
+  }
+}
+
+
+
 /***** stat "percentsolve" *****/
 
 void CalcPercentSolve() {
@@ -2071,73 +3227,78 @@ void ColumnRunCalculation() {
   for (j=0;j<listColumns.iNumItems;j++) {
     pCol = &aColumns[j];
     if (pCol->bActive) {
-      switch(pCol->eColType)
-      {
-        case ColTypeFinal:
-          switch(pCol->eSourceDataType)
-          {
-          case DTypeUInt:
-            pCol->uiCurRowValue = *pCol->puiCurValue;
-            break;
-          case DTypeSInt:
-            pCol->siCurRowValue = *pCol->psiCurValue;
-            break;
-          case DTypeFloat:
-            pCol->fCurRowValue = *pCol->pfCurValue;
-            break;
-          }
-          break;
-        case ColTypeMin:
-        case ColTypeMax:
-          switch(pCol->eSourceDataType)
-          {
-          case DTypeUInt:
-            pCol->uiCurRowValue = pCol->uiMinMaxVal;
-            break;
-          case DTypeSInt:
-            pCol->siCurRowValue = pCol->siMinMaxVal;
-            break;
-          case DTypeFloat:
-            pCol->fCurRowValue = pCol->fMinMaxVal;
-            break;
-          }
-          break;
-        case ColTypeFinalDivStep:
-        case ColTypeFinalDivStep100:
-          switch(pCol->eSourceDataType)
-          {
-          case DTypeUInt:
-            pCol->fCurRowValue = (FLOAT) *pCol->puiCurValue;
+
+      /* (the coordinator of a run farm has the row values of the worker) */
+
+      if (!bFarmCoordinator) {
+        switch(pCol->eColType)
+        {
+          case ColTypeFinal:
+            switch(pCol->eSourceDataType)
+            {
+            case DTypeUInt:
+              pCol->uiCurRowValue = *pCol->puiCurValue;
+              break;
+            case DTypeSInt:
+              pCol->siCurRowValue = *pCol->psiCurValue;
+              break;
+            case DTypeFloat:
+              pCol->fCurRowValue = *pCol->pfCurValue;
+              break;
+            }
             break;
-          case DTypeSInt:
-            pCol->fCurRowValue = (FLOAT) *pCol->psiCurValue;
+          case ColTypeMin:
+          case ColTypeMax:
+            switch(pCol->eSourceDataType)
+            {
+            case DTypeUInt:
+              pCol->uiCurRowValue = pCol->uiMinMaxVal;
+              break;
+            case DTypeSInt:
+              pCol->siCurRowValue = pCol->siMinMaxVal;
+              break;
+            case DTypeFloat:
+              pCol->fCurRowValue = pCol->fMinMaxVal;
+              break;
+            }
             break;
-          case DTypeFloat:
-            pCol->fCurRowValue = *pCol->pfCurValue;
+          case ColTypeFinalDivStep:
+          case ColTypeFinalDivStep100:
+            switch(pCol->eSourceDataType)
+            {
+            case DTypeUInt:
+              pCol->fCurRowValue = (FLOAT) *pCol->puiCurValue;
+              break;
+            case DTypeSInt:
+              pCol->fCurRowValue = (FLOAT) *pCol->psiCurValue;
+              break;
+            case DTypeFloat:
+              pCol->fCurRowValue = *pCol->pfCurValue;
+              break;
+            }
+            pCol->fCurRowValue *= fStepMul;
+            if (pCol->eColType == ColTypeFinalDivStep100) {
+              pCol->fCurRowValue *= 100.0f;
+            }
             break;
-          }
-          pCol->fCurRowValue *= fStepMul;
-          if (pCol->eColType == ColTypeFinalDivStep100) {
-            pCol->fCurRowValue *= 100.0f;
-          }
-          break;
 
-        case ColTypeMean:
-        case ColTypeStddev:
-        case ColTypeCV:
+          case ColTypeMean:
+          case ColTypeStddev:
+          case ColTypeCV:
 
-          CalculateStats(&fMean,&fStddev,&fCV,pCol->fRowSum,pCol->fRowSum2,iStep);
+            CalculateStats(&fMean,&fStddev,&fCV,pCol->fRowSum,pCol->fRowSum2,StatStep());
 
-          if (pCol->eColType == ColTypeMean) {
-            pCol->fCurRowValue = fMean;
-          } else {
-            if (pCol->eColType == ColTypeStddev) {
-              pCol->fCurRowValue = fStddev;
+            if (pCol->eColType == ColTypeMean) {
+              pCol->fCurRowValue = fMean;
             } else {
-              pCol->fCurRowValue = fCV;
+              if (pCol->eColType == ColTypeStddev) {
+                pCol->fCurRowValue = fStddev;
+              } else {
+                pCol->fCurRowValue = fCV;
+              }
             }
-          }
-          break;
+            break;
+        }
       }
       if (pCol->bAllocateColumnRAM) {
         if (pCol->eFinalDataType == DTypeUInt) {
@@ -2158,6 +3319,10 @@ void ColumnRunCalculation() {
       pCol->fColSum += pCol->fCurRowValue;
       pCol->fColSum2 += (pCol->fCurRowValue * pCol->fCurRowValue);
 
+      if (pCol->bStreamColumn) {
+        StreamStatAdd(pCol->pStreamData,pCol->fCurRowValue,bSolutionFound,(FLOAT) iStep);
+      }
+
     }
   }
 }
@@ -2170,40 +3335,13 @@ void ColumnStepCalculation() {
 
   UINT32 j;
   REPORTCOL *pCol;
+
+  /* min & max are updated on every step (also with -statsample) */
   
-  for (j=0;j<iNumActiveCalcColumns;j++) {
-    pCol = &aColumns[aActiveCalcColumns[j]];
+  for (j=0;j<iNumActiveMinMaxColumns;j++) {
+    pCol = &aColumns[aActiveMinMaxColumns[j]];
     switch(pCol->eColType)
     {
-      case ColTypeStddev:
-      case ColTypeCV:
-        switch(pCol->eSourceDataType)
-        {
-        case DTypeUInt:
-          pCol->fRowSum2 += ((FLOAT) *pCol->puiCurValue) * ((FLOAT) *pCol->puiCurValue);
-          break;
-        case DTypeSInt:
-          pCol->fRowSum2 += ((FLOAT) *pCol->psiCurValue) * ((FLOAT) *pCol->psiCurValue);
-          break;
-        case DTypeFloat:
-          pCol->fRowSum2 += ((*pCol->pfCurValue) * (*pCol->pfCurValue));
-          break;
-        }
-      case ColTypeMean:
-        switch(pCol->eSourceDataType)
-        {
-        case DTypeUInt:
-          pCol->fRowSum += (FLOAT) *pCol->puiCurValue;
-          break;
-        case DTypeSInt:
-          pCol->fRowSum += (FLOAT) *pCol->psiCurValue;
-          break;
-        case DTypeFloat:
-          pCol->fRowSum += *pCol->pfCurValue;
-          break;
-        }
-        break;
-
       case ColTypeMin:
         switch(pCol->eSourceDataType)
         {
@@ -2237,19 +3375,60 @@ void ColumnStepCalculation() {
   }
 }
 
+/***** Trigger ColumnStepMeanCalculation *****/
+
+void ColumnStepMeanCalculation() {
+
+  UINT32 j;
+  REPORTCOL *pCol;
+  
+  for (j=0;j<iNumActiveMeanColumns;j++) {
+    pCol = &aColumns[aActiveMeanColumns[j]];
+    switch(pCol->eColType)
+    {
+      case ColTypeStddev:
+      case ColTypeCV:
+        switch(pCol->eSourceDataType)
+        {
+        case DTypeUInt:
+          pCol->fRowSum2 += ((FLOAT) *pCol->puiCurValue) * ((FLOAT) *pCol->puiCurValue);
+          break;
+        case DTypeSInt:
+          pCol->fRowSum2 += ((FLOAT) *pCol->psiCurValue) * ((FLOAT) *pCol->psiCurValue);
+          break;
+        case DTypeFloat:
+          pCol->fRowSum2 += ((*pCol->pfCurValue) * (*pCol->pfCurValue));
+          break;
+        }
+      case ColTypeMean:
+        switch(pCol->eSourceDataType)
+        {
+        case DTypeUInt:
+          pCol->fRowSum += (FLOAT) *pCol->puiCurValue;
+          break;
+        case DTypeSInt:
+          pCol->fRowSum += (FLOAT) *pCol->psiCurValue;
+          break;
+        case DTypeFloat:
+          pCol->fRowSum += *pCol->pfCurValue;
+          break;
+        }
+        break;
+    }
+  }
+}
+
 
 
 /***** Trigger CalcFPS *****/
 
 void CalcFPS() {
-  UINT32 j;
   REPORTCOL *pCol;
 
+  /* the column sum is also available with -rstream (no column data) */
+
   pCol = &aColumns[FindItem(&listColumns,"steps")];
-  fFlipsPerSecond = FLOATZERO;
-  for (j=0;j< iRun;j++) {
-    fFlipsPerSecond += GetRowElement(pCol,j,FALSE,FALSE);
-  }
+  fFlipsPerSecond = pCol->fColSum;
   fFlipsPerSecond /= fTotalTime;
 }
 
@@ -2387,7 +3566,7 @@ void UpdateMobilityColumn() {
       } 
     }
 
-    CalculateStats(&fMobilityColNMean,&fStdDev,&fMobilityColNCV,aMobilityWindowSum[iNumVars],aMobilityWindowSum2[iNumVars],iCount);
+    CalculateStats(&fMobilityColNMean,&fStdDev,&fMobilityColNCV,fMobilityNSum,fMobilityNSum2,iCount);
     fMobilityColNMeanNorm = fMobilityColNMean / (FLOAT) iNumVars;
 
   }
@@ -2402,7 +3581,7 @@ void UpdateMobilityColumn() {
       } 
     }
 
-    CalculateStats(&fMobilityColXMean,&fStdDev,&fMobilityColXCV,aMobilityWindowSum[iMobFixedWindow],aMobilityWindowSum2[iMobFixedWindow],iCount);
+    CalculateStats(&fMobilityColXMean,&fStdDev,&fMobilityColXCV,fMobilityFixedSum,fMobilityFixedSum2,iCount);
     if (iMobFixedWindow < iNumVars) {
       fMobilityColXMeanNorm = fMobilityColXMean / (FLOAT) iMobFixedWindow;
     } else {
@@ -0,0 +1,506 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+
+#include "ubcsat.h"
+
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+/*
+    Solver service (-serve FILE -serveworkers N)
+
+    the process forks N workers and stays behind to restart any worker
+    that exits (and to stop them all on SIGINT / SIGTERM).  The workers
+    accept the connections on the socket and solve one request at a time,
+    exactly like the instances of batch mode (-instlist): the algorithm,
+    triggers and reports are set up once, and the RAM of each request is
+    released and reused for the next one.
+
+    a request is a line of parameters (may be empty) followed by the
+    instance (.cnf or .wcnf), e.g.:
+
+      -cutoff 1000000 -timeout 2 -wp 0.05
+      p cnf 3 2
+      1 -2 0
+      2 3 0
+
+    the parameters can be any (numeric) parameter of the algorithm and
+    -runs, -cutoff, -timeout, -gtimeout, -target, -wtarget, -seed, -find
+    (the values from the command-line are the defaults for each request)
+
+    the reply is in the style of the SAT / MAX-SAT competitions:
+
+      c runs 1 solved 1 steps 23 time 0.000112
+      o 0
+      s SATISFIABLE              (or s UNKNOWN)
+      v 1 -2 3 0
+
+    the o & v lines have the best assignment found in any run
+    (the first solution found, unless -find is larger than 1).
+    A request that cannot be read is closed without a reply.
+*/
+
+char *sServeSocket;
+UINT32 iServeWorkers;
+BOOL bServeMode;
+
+FILE *filServeIn;
+
+#ifndef WIN32
+
+const char *aServeParms[] = {"-runs","-cutoff","-timeout","-gtimeout","-target","-wtarget","-seed","-find",NULL};
+
+int iServeListen = -1;
+FILE *filServeOut;
+pid_t aServePids[MAXSERVEWORKERS];
+volatile BOOL bServeStop;
+UINT32 iNumServeRequests;
+char sServeName[MAXCNFLINELEN];
+
+VARSTATE vsServeBest;
+UINT32 iServeBest;
+FLOAT fServeBestW;
+BOOL bServeSolved;
+
+void ServeSignal(int iSig) {
+  NOREF(iSig);
+  bServeStop = TRUE;
+}
+
+pid_t ServeFork() {
+
+  pid_t iPid;
+
+  iPid = fork();
+  if (iPid == 0) {
+    signal(SIGINT,SIG_DFL);
+    signal(SIGTERM,SIG_DFL);
+  }
+  return(iPid);
+}
+
+void ServeClose() {
+  if (filServeIn) {
+    fclose(filServeIn);
+    filServeIn = NULL;
+  }
+  if (filServeOut) {
+    fclose(filServeOut);
+    filServeOut = NULL;
+  }
+}
+
+void ServeRefuse() {
+
+  /* the rest of the request is read (for a while), so that the client
+     gets the error rather than a reset connection */
+
+  struct pollfd pfd;
+
+  fflush(filServeOut);
+  shutdown(fileno(filServeOut),SHUT_WR);
+
+  pfd.fd = fileno(filServeIn);
+  pfd.events = POLLIN;
+  while ((poll(&pfd,1,SERVEPOLLMS) > 0) && (read(pfd.fd,sLine,MAXCNFLINELEN) > 0)) {
+  }
+
+  ServeClose();
+}
+
+BOOL ServeMatchSwitch(const char *sSwitch, const char *sParm) {
+
+  /* sSwitch can have aliases: "-find,-numsol" */
+
+  size_t iLen;
+
+  iLen = strlen(sParm);
+  while (*sSwitch) {
+    if ((strncmp(sSwitch,sParm,iLen)==0) && ((sSwitch[iLen] == ',') || (sSwitch[iLen] == 0))) {
+      return(TRUE);
+    }
+    while ((*sSwitch) && (*sSwitch != ',')) {
+      sSwitch++;
+    }
+    if (*sSwitch) {
+      sSwitch++;
+    }
+  }
+  return(FALSE);
+}
+
+ALGPARM *ServeFindParm(const char *sParm) {
+
+  UINT32 j;
+  ALGPARM *pParm;
+
+  for (j=0;j<pActiveAlgorithm->parmList.iNumParms;j++) {
+    pParm = &pActiveAlgorithm->parmList.aParms[j];
+    if (ServeMatchSwitch(pParm->sSwitch,sParm)) {
+      if (*pParm->sTriggers) {
+        return(NULL);
+      }
+      return(pParm);
+    }
+  }
+  for (j=0;aServeParms[j];j++) {
+    if (strcmp(aServeParms[j],sParm)==0) {
+      break;
+    }
+  }
+  if (aServeParms[j] == NULL) {
+    return(NULL);
+  }
+  for (j=0;j<parmUBCSAT.iNumParms;j++) {
+    pParm = &parmUBCSAT.aParms[j];
+    if (ServeMatchSwitch(pParm->sSwitch,sParm)) {
+      return(pParm);
+    }
+  }
+  return(NULL);
+}
+
+BOOL ServeSetParm(ALGPARM *pParm, const char *sValue) {
+
+  float fTemp;
+  UINT32 iTemp;
+  SINT32 siTemp;
+
+  switch (pParm->eType) {
+    case PTypeUInt:
+      if (strcmp(sValue,"max")==0) {
+        *(UINT32 *) pParm->pParmValue = UINT32MAX;
+        return(TRUE);
+      }
+      if (sscanf(sValue,"%lu",&iTemp) != 1) {
+        return(FALSE);
+      }
+      *(UINT32 *) pParm->pParmValue = iTemp;
+      return(TRUE);
+    case PTypeSInt:
+      if (sscanf(sValue,"%ld",&siTemp) != 1) {
+        return(FALSE);
+      }
+      *(SINT32 *) pParm->pParmValue = siTemp;
+      return(TRUE);
+    case PTypeBool:
+      if (sscanf(sValue,"%lu",&iTemp) != 1) {
+        return(FALSE);
+      }
+      *(BOOL *) pParm->pParmValue = (iTemp != 0);
+      return(TRUE);
+    case PTypeProbability:
+      if (sscanf(sValue,"%f",&fTemp) != 1) {
+        return(FALSE);
+      }
+      *(PROBABILITY *) pParm->pParmValue = FloatToProb(fTemp);
+      return(TRUE);
+    case PTypeFloat:
+      if (sscanf(sValue,"%f",&fTemp) != 1) {
+        return(FALSE);
+      }
+      *(FLOAT *) pParm->pParmValue = (FLOAT) fTemp;
+      return(TRUE);
+    default:
+      return(FALSE);
+  }
+}
+
+BOOL ServeRequestParms(char *sParms) {
+
+  char *sParm;
+  char *sValue;
+  ALGPARM *pParm;
+
+  sParm = strtok(sParms," \t\r\n");
+  while (sParm) {
+    sValue = strtok(NULL," \t\r\n");
+    pParm = ServeFindParm(sParm);
+    if ((pParm == NULL) || (sValue == NULL)) {
+      fprintf(filServeOut,"c error: parameter [%s] can not be used in a request\n",sParm);
+      return(FALSE);
+    }
+    if (!ServeSetParm(pParm,sValue)) {
+      fprintf(filServeOut,"c error: invalid value [%s] for [%s]\n",sValue,sParm);
+      return(FALSE);
+    }
+    sParm = strtok(NULL," \t\r\n");
+  }
+  return(TRUE);
+}
+
+#endif
+
+void SetupServe() {
+#ifndef WIN32
+  struct sockaddr_un addr;
+  struct sigaction sa;
+  pid_t iPid;
+  int iStatus;
+  UINT32 j;
+
+  bServeMode = TRUE;
+  bBatchMode = TRUE;
+
+  if ((*sFilenameIn) || (*sFilenameInstList)) {
+    ReportPrint(pRepErr,"Error: -serve cannot be used with -inst or -instlist\n");
+    AbnormalExit();
+  }
+  if ((iFarmWorkers > 0) || (*sFarmCoordinator) || (*sFarmWorker) || (iCoopWorkers > 1)) {
+    ReportPrint(pRepErr,"Error: -serve cannot be used with a run farm or -coop\n");
+    AbnormalExit();
+  }
+  if ((*sFilenameCheckpoint) || (*sFilenameResume) || (*sFilenameRandomData)) {
+    ReportPrint(pRepErr,"Error: -serve cannot be used with -checkpoint, -resume or -filerand\n");
+    AbnormalExit();
+  }
+  if ((iServeWorkers == 0) || (iServeWorkers > MAXSERVEWORKERS)) {
+    ReportPrint1(pRepErr,"Error: -serveworkers must be from 1 to %d\n",MAXSERVEWORKERS);
+    AbnormalExit();
+  }
+
+  if (strcmp(pRepBatch->sOutputFile,"null")) {
+    pRepBatch->bActive = TRUE;
+  }
+
+  iServeListen = socket(AF_UNIX,SOCK_STREAM,0);
+  memset(&addr,0,sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path,sServeSocket,sizeof(addr.sun_path) - 1);
+  unlink(sServeSocket);
+  if ((iServeListen < 0) || (bind(iServeListen,(struct sockaddr *) &addr,sizeof(addr))) || (listen(iServeListen,SERVEBACKLOG))) {
+    ReportPrint1(pRepErr,"Error: could not listen on [%s]\n",sServeSocket);
+    AbnormalExit();
+  }
+
+  /* (a client that has gone is noticed when replying) */
+
+  signal(SIGPIPE,SIG_IGN);
+
+  /* anything buffered now would be written by every process */
+
+  RFFlush();
+  fflush(NULL);
+
+  for (j=0;j<iServeWorkers;j++) {
+    aServePids[j] = ServeFork();
+    if (aServePids[j] == 0) {
+      return;
+    }
+  }
+
+  /* (without SA_RESTART, so that waitpid() returns on a signal) */
+
+  memset(&sa,0,sizeof(sa));
+  sa.sa_handler = ServeSignal;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGINT,&sa,NULL);
+  sigaction(SIGTERM,&sa,NULL);
+
+  while (!bServeStop) {
+    iPid = waitpid(-1,&iStatus,0);
+    if (iPid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    for (j=0;j<iServeWorkers;j++) {
+      if (aServePids[j] == iPid) {
+        if (bServeStop) {
+          aServePids[j] = 0;
+          break;
+        }
+        aServePids[j] = ServeFork();
+        if (aServePids[j] == 0) {
+          return;
+        }
+        break;
+      }
+    }
+  }
+
+  for (j=0;j<iServeWorkers;j++) {
+    if (aServePids[j] > 0) {
+      kill(aServePids[j],SIGTERM);
+    }
+  }
+  for (j=0;j<iServeWorkers;j++) {
+    if (aServePids[j] > 0) {
+      waitpid(aServePids[j],&iStatus,0);
+    }
+  }
+  close(iServeListen);
+  unlink(sServeSocket);
+  CleanExit();
+  exit(0);
+#else
+  ReportPrint(pRepErr,"Error: -serve is not supported on this platform\n");
+  AbnormalExit();
+#endif
+}
+
+BOOL ServeAccept() {
+#ifndef WIN32
+  struct pollfd pfd;
+  int iConn;
+
+  ServeClose();
+
+  while (TRUE) {
+
+    /* a worker of a service that has gone exits */
+
+    pfd.fd = iServeListen;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    if (poll(&pfd,1,SERVEPOLLMS) <= 0) {
+      if (getppid() == 1) {
+        exit(0);
+      }
+      continue;
+    }
+
+    iConn = accept(iServeListen,NULL,NULL);
+    if (iConn < 0) {
+      continue;
+    }
+
+    filServeIn = fdopen(iConn,"r");
+    filServeOut = fdopen(dup(iConn),"w");
+    if ((filServeIn == NULL) || (filServeOut == NULL)) {
+      if (filServeIn == NULL) {
+        close(iConn);
+      }
+      ServeClose();
+      continue;
+    }
+
+    if ((fgets(sLine,MAXCNFLINELEN,filServeIn) == NULL) || (!ServeRequestParms(sLine))) {
+      ServeRefuse();
+      continue;
+    }
+
+    RandomSeed(iSeed);
+
+    iNumServeRequests++;
+    sprintf(sServeName,"%s:%lu:%lu",sServeSocket,(unsigned long) getpid(),(unsigned long) iNumServeRequests);
+    sFilenameIn = sServeName;
+
+    return(TRUE);
+  }
+#else
+  return(FALSE);
+#endif
+}
+
+void InitServeBest() {
+#ifndef WIN32
+  vsServeBest = NewVarState();
+  iServeBest = iNumClauses + 1;
+  fServeBestW = fTotalWeight + 1.0f;
+  bServeSolved = FALSE;
+
+  /* (the first solution found is returned, unless more are asked for) */
+
+  if (iFind == 0) {
+    iFind = 1;
+  }
+#endif
+}
+
+void UpdateServeBest() {
+#ifndef WIN32
+  if (bServeSolved) {
+    return;
+  }
+  if (bSolutionFound) {
+    SetCurVarState(vsServeBest);
+    iServeBest = iNumFalse;
+    fServeBestW = fSumFalseW;
+    bServeSolved = TRUE;
+    return;
+  }
+  if (bWeighted) {
+    if (fBestSumFalseW < fServeBestW) {
+      fServeBestW = fBestSumFalseW;
+      MaterializeSaveBest();
+      memcpy(vsServeBest,vsBest,iVARSTATELen);
+    }
+  } else {
+    if (iBestNumFalse < iServeBest) {
+      iServeBest = iBestNumFalse;
+      MaterializeSaveBest();
+      memcpy(vsServeBest,vsBest,iVARSTATELen);
+    }
+  }
+#endif
+}
+
+void ServeReply() {
+#ifndef WIN32
+  UINT32 j;
+  REPORTCOL *pColSteps;
+
+  if (filServeOut == NULL) {
+    return;
+  }
+
+  pColSteps = &aColumns[FindItem(&listColumns,"steps")];
+
+  fprintf(filServeOut,"c runs %lu solved %lu steps %.0f time %f\n",(unsigned long) iRun,(unsigned long) iNumSolutionsFound,pColSteps->fColSum,fTotalTime);
+  if (iRun) {
+    if (bWeighted) {
+      fprintf(filServeOut,"o %.12g\n",fServeBestW);
+    } else {
+      fprintf(filServeOut,"o %lu\n",(unsigned long) iServeBest);
+    }
+  }
+  if (bServeSolved) {
+    fprintf(filServeOut,"s SATISFIABLE\n");
+  } else {
+    fprintf(filServeOut,"s UNKNOWN\n");
+  }
+  if (iRun) {
+    fprintf(filServeOut,"v");
+    for (j=1;j<=iNumVars;j++) {
+      if (GetVarStateBit(vsServeBest,j-1)) {
+        fprintf(filServeOut," %lu",(unsigned long) j);
+      } else {
+        fprintf(filServeOut," -%lu",(unsigned long) j);
+      }
+    }
+    fprintf(filServeOut," 0\n");
+  }
+
+  ServeClose();
+#endif
+}
+
@@ -0,0 +1,43 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$
+      ##  ##  ##  ##  ##      $$      $$  $$    $$
+      ##  ##  #####   ##       $$$$   $$$$$$    $$
+      ##  ##  ##  ##  ##          $$  $$  $$    $$
+       ####   #####    #####  $$$$$   $$  $$    $$
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+
+/*
+    Solver service (-serve FILE)
+
+    sServeSocket          Unix socket the service accepts requests on
+    iServeWorkers         number of worker processes serving requests
+    bServeMode            this process is (a worker of) the service
+*/
+
+extern char *sServeSocket;
+extern UINT32 iServeWorkers;
+extern BOOL bServeMode;
+
+extern FILE *filServeIn;
+
+void SetupServe();
+BOOL ServeAccept();
+void InitServeBest();
+void UpdateServeBest();
+void ServeReply();
+
@@ -0,0 +1,218 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$    
+      ##  ##  ##  ##  ##      $$      $$  $$    $$      
+      ##  ##  #####   ##       $$$$   $$$$$$    $$      
+      ##  ##  ##  ##  ##          $$  $$  $$    $$      
+       ####   #####    #####  $$$$$   $$  $$    $$      
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+#include "ubcsat.h"
+
+/*  
+    This file contains the (very simple) thread support used to build
+    the state information for large instances, and the persistent thread
+    pool used by the parallel flips.  On WIN32 (or if pthreads are not
+    available) all of the blocks run on the calling thread.
+*/
+
+UINT32 ParallelBlocks(UINT32 iNumItems);
+void ParallelFor(UINT32 iNumItems, PARALLELFXN fxnBlock);
+
+void StartThreadPool();
+void PoolFor(UINT32 iNumItems, PARALLELFXN fxnBlock);
+
+UINT32 iNumThreads;
+UINT32 iNumPoolThreads;
+
+typedef struct typePARALLELBLOCK {
+  PARALLELFXN fxnBlock;
+  UINT32 iThread;
+  UINT32 iFirst;
+  UINT32 iLast;
+  BOOL bStarted;
+#ifndef WIN32
+  pthread_t tid;
+#endif
+} PARALLELBLOCK;
+
+PARALLELBLOCK aParallelBlocks[MAXTHREADS];
+
+UINT32 ParallelBlocks(UINT32 iNumItems) {
+  UINT32 iBlocks;
+
+  iBlocks = iNumThreads;
+
+  if (iBlocks > MAXTHREADS) {
+    iBlocks = MAXTHREADS;
+  }
+  if (iBlocks > iNumItems / PARALLELMINITEMS) {
+    iBlocks = iNumItems / PARALLELMINITEMS;
+  }
+  if (iBlocks == 0) {
+    iBlocks = 1;
+  }
+  return(iBlocks);
+}
+
+void *RunParallelBlock(void *pBlock) {
+  PARALLELBLOCK *pCur = (PARALLELBLOCK *) pBlock;
+  pCur->fxnBlock(pCur->iThread,pCur->iFirst,pCur->iLast);
+  return(NULL);
+}
+
+void ParallelFor(UINT32 iNumItems, PARALLELFXN fxnBlock) {
+  UINT32 j;
+  UINT32 iBlocks;
+
+  iBlocks = ParallelBlocks(iNumItems);
+
+  if (iBlocks == 1) {
+    fxnBlock(0,0,iNumItems);
+    return;
+  }
+
+  for (j=0;j<iBlocks;j++) {
+    aParallelBlocks[j].fxnBlock = fxnBlock;
+    aParallelBlocks[j].iThread = j;
+    aParallelBlocks[j].iFirst = (iNumItems / iBlocks) * j;
+    aParallelBlocks[j].iLast = (j == iBlocks - 1) ? iNumItems : (iNumItems / iBlocks) * (j + 1);
+    aParallelBlocks[j].bStarted = FALSE;
+  }
+
+#ifndef WIN32
+  for (j=1;j<iBlocks;j++) {
+    if (pthread_create(&aParallelBlocks[j].tid,NULL,RunParallelBlock,(void *) &aParallelBlocks[j])==0) {
+      aParallelBlocks[j].bStarted = TRUE;
+    }
+  }
+#endif
+
+  RunParallelBlock((void *) &aParallelBlocks[0]);
+
+  /* blocks that could not be given a thread are run here */
+
+  for (j=1;j<iBlocks;j++) {
+#ifndef WIN32
+    if (aParallelBlocks[j].bStarted) {
+      pthread_join(aParallelBlocks[j].tid,NULL);
+      continue;
+    }
+#endif
+    RunParallelBlock((void *) &aParallelBlocks[j]);
+  }
+}
+
+/*
+    the pool threads are started once, and wait for work by spinning on
+    iPoolGeneration (for up to POOLSPIN checks) before sleeping on a
+    condition variable, so that the many small dispatches made by the
+    parallel flips don't each pay for a thread start (or a wake up)
+*/
+
+#ifndef WIN32
+
+PARALLELBLOCK aPoolBlocks[MAXTHREADS];
+
+UINT32 iPoolGeneration;
+UINT32 iPoolPending;
+
+pthread_mutex_t mutPool = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t condPool = PTHREAD_COND_INITIALIZER;
+
+void *RunPoolThread(void *pBlock) {
+  PARALLELBLOCK *pCur = (PARALLELBLOCK *) pBlock;
+  UINT32 iSeen = 0;
+  UINT32 j;
+
+  while (1) {
+    for (j=0;(j<POOLSPIN)&&(__atomic_load_n(&iPoolGeneration,__ATOMIC_ACQUIRE)==iSeen);j++);
+    if (__atomic_load_n(&iPoolGeneration,__ATOMIC_ACQUIRE)==iSeen) {
+      pthread_mutex_lock(&mutPool);
+      while (__atomic_load_n(&iPoolGeneration,__ATOMIC_ACQUIRE)==iSeen) {
+        pthread_cond_wait(&condPool,&mutPool);
+      }
+      pthread_mutex_unlock(&mutPool);
+    }
+    iSeen = __atomic_load_n(&iPoolGeneration,__ATOMIC_ACQUIRE);
+    pCur->fxnBlock(pCur->iThread,pCur->iFirst,pCur->iLast);
+    __atomic_fetch_sub(&iPoolPending,1,__ATOMIC_RELEASE);
+  }
+  return(NULL);
+}
+
+#endif
+
+void StartThreadPool() {
+#ifndef WIN32
+  UINT32 j;
+
+  if (iNumPoolThreads) {
+    return;
+  }
+
+  iNumPoolThreads = 1;
+
+  for (j=1;(j<iNumThreads)&&(j<MAXTHREADS);j++) {
+    aPoolBlocks[j].iThread = j;
+    aPoolBlocks[j].iFirst = 0;
+    aPoolBlocks[j].iLast = 0;
+    if (pthread_create(&aPoolBlocks[j].tid,NULL,RunPoolThread,(void *) &aPoolBlocks[j])) {
+      break;
+    }
+    pthread_detach(aPoolBlocks[j].tid);
+    iNumPoolThreads++;
+  }
+#else
+  iNumPoolThreads = 1;
+#endif
+}
+
+void PoolFor(UINT32 iNumItems, PARALLELFXN fxnBlock) {
+#ifndef WIN32
+  UINT32 j;
+  UINT32 iBlockSize;
+
+  if (iNumPoolThreads < 2) {
+    fxnBlock(0,0,iNumItems);
+    return;
+  }
+
+  iBlockSize = (iNumItems + iNumPoolThreads - 1) / iNumPoolThreads;
+
+  for (j=1;j<iNumPoolThreads;j++) {
+    aPoolBlocks[j].fxnBlock = fxnBlock;
+    aPoolBlocks[j].iFirst = (iBlockSize * j < iNumItems) ? iBlockSize * j : iNumItems;
+    aPoolBlocks[j].iLast = (iBlockSize * (j + 1) < iNumItems) ? iBlockSize * (j + 1) : iNumItems;
+  }
+  __atomic_store_n(&iPoolPending,iNumPoolThreads - 1,__ATOMIC_RELAXED);
+
+  pthread_mutex_lock(&mutPool);
+  __atomic_fetch_add(&iPoolGeneration,1,__ATOMIC_RELEASE);
+  pthread_cond_broadcast(&condPool);
+  pthread_mutex_unlock(&mutPool);
+
+  fxnBlock(0,0,(iBlockSize < iNumItems) ? iBlockSize : iNumItems);
+
+  for (j=0;__atomic_load_n(&iPoolPending,__ATOMIC_ACQUIRE);j++) {
+    if (j >= POOLSPIN) {
+      sched_yield();
+    }
+  }
+#else
+  fxnBlock(0,0,iNumItems);
+#endif
+}
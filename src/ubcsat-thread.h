@@ -0,0 +1,60 @@
+/*
+
+      ##  ##  #####    #####   $$$$$   $$$$   $$$$$$    
+      ##  ##  ##  ##  ##      $$      $$  $$    $$      
+      ##  ##  #####   ##       $$$$   $$$$$$    $$      
+      ##  ##  ##  ##  ##          $$  $$  $$    $$      
+       ####   #####    #####  $$$$$   $$  $$    $$      
+  ======================================================
+  SLS SAT Solver from The University of British Columbia
+  ======================================================
+  ...Developed by Dave Tompkins (davet [@] cs.ubc.ca)...
+  ------------------------------------------------------
+  .......consult legal.txt for legal information........
+  ......consult revisions.txt for revision history......
+  ------------------------------------------------------
+  ... project website: http://www.satlib.org/ubcsat ....
+  ------------------------------------------------------
+  .....e-mail ubcsat-help [@] cs.ubc.ca for support.....
+  ------------------------------------------------------
+
+*/
+
+#ifndef WIN32
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+    ParallelFor() splits the items [0,iNumItems) into contiguous blocks
+    and calls fxnBlock(iThread,iFirst,iLast) for each block, with each
+    block running on its own thread.  Blocks have at least PARALLELMINITEMS
+    items, so small instances run on the calling thread only.
+
+    the blocks are numbered 0..(ParallelBlocks(iNumItems) - 1), so
+    per-thread accumulators can be indexed by iThread, and block 0 always
+    has the lowest items (combining the accumulators in block order gives
+    the same result as a single pass)
+*/
+
+typedef void (*PARALLELFXN)(UINT32 iThread, UINT32 iFirst, UINT32 iLast);
+
+UINT32 ParallelBlocks(UINT32 iNumItems);
+void ParallelFor(UINT32 iNumItems, PARALLELFXN fxnBlock);
+
+/*
+    PoolFor() is the same as ParallelFor(), but the blocks run on a
+    persistent pool of (iNumThreads - 1) threads plus the calling thread,
+    and there is no minimum block size: it is used for the many small
+    (but latency bound) loops of the parallel flips
+
+    StartThreadPool() must be called first (iNumPoolThreads is the number of
+    threads in the pool, including the calling thread)
+*/
+
+void StartThreadPool();
+void PoolFor(UINT32 iNumItems, PARALLELFXN fxnBlock);
+
+extern UINT32 iNumThreads;
+extern UINT32 iNumPoolThreads;
+
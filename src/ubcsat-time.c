@@ -33,14 +33,28 @@ void StopTotalClock();
 void StartRunClock();
 void StopRunClock();
 
+void StartReadClock();
+void StopReadClock();
+
+void CalcPeakRSS();
+
+void StartWallClock();
+void CalcFirstFlipTime();
+
 double TotalTimeElapsed();
 double RunTimeElapsed();
 
 double fTotalTime;
 double fRunTime;
+double fReadTime;
+double fFirstFlipTime;
+
+UINT32 iPeakRSS;
 
 double fStartTotalTimeStamp;
 double fStartRunTimeStamp;
+double fStartReadTimeStamp;
+double fStartWallTimeStamp;
 
 double fCurrentTimeStamp;
 
@@ -52,7 +66,7 @@ double fCurrentTimeStamp;
 
   struct timeval tv;
   struct timezone tzp;
-  struct tms prog_tms;
+  struct rusage prog_rusage;
 
 #endif
 
@@ -63,6 +77,11 @@ double fCurrentTimeStamp;
     fCurrentTimeStamp = ((double) tstruct.time + ((double)tstruct.millitm)/1000.0);
   }
 
+  double CurrentWallTime() {
+    _ftime( &tstruct );
+    return((double) tstruct.time + ((double)tstruct.millitm)/1000.0);
+  }
+
   void InitSeed() {
     _ftime( &tstruct );
     iSeed = (( ((UINT32) tstruct.time) & 0x001FFFFF ) * 1000) + tstruct.millitm;
@@ -70,9 +89,16 @@ double fCurrentTimeStamp;
 
 #else
 
+  /* getrusage() has microsecond resolution (times() only has clock ticks) */
+
   void CurrentTime() {
-    times(&prog_tms);
-    fCurrentTimeStamp = (double)prog_tms.tms_utime / ((double)sysconf(_SC_CLK_TCK));
+    getrusage(RUSAGE_SELF,&prog_rusage);
+    fCurrentTimeStamp = (double)prog_rusage.ru_utime.tv_sec + ((double)prog_rusage.ru_utime.tv_usec)/1000000.0;
+  }
+
+  double CurrentWallTime() {
+    gettimeofday(&tv,&tzp);
+    return((double)tv.tv_sec + ((double)tv.tv_usec)/1000000.0);
   }
 
   void InitSeed() {
@@ -122,3 +148,49 @@ void StopRunClock() {
   fRunTime = RunTimeElapsed();
 }
 
+void StartReadClock() {
+  CurrentTime();
+  fStartReadTimeStamp = fCurrentTimeStamp;
+}
+
+void StopReadClock() {
+  fReadTime = TimeElapsed(fStartReadTimeStamp);
+}
+
+/*  
+    The peak resident set size is reported in kilobytes
+    (getrusage reports bytes on OS X, and is not available on WIN32)
+*/
+
+void CalcPeakRSS() {
+#ifdef WIN32
+  iPeakRSS = 0;
+#else
+  if (getrusage(RUSAGE_SELF,&prog_rusage)==0) {
+#ifdef __APPLE__
+    iPeakRSS = (UINT32) (prog_rusage.ru_maxrss / 1024);
+#else
+    iPeakRSS = (UINT32) prog_rusage.ru_maxrss;
+#endif
+  } else {
+    iPeakRSS = 0;
+  }
+#endif
+}
+
+/*
+    The time to first flip is measured in wall clock time (not CPU time)
+    from the start of UBCSAT until the first run is initialized, so that it
+    includes reading the instance and (possibly parallel) initialization
+*/
+
+void StartWallClock() {
+  fStartWallTimeStamp = CurrentWallTime();
+}
+
+void CalcFirstFlipTime() {
+  if ((iRun == 1) && (fFirstFlipTime == FLOATZERO)) {
+    fFirstFlipTime = CurrentWallTime() - fStartWallTimeStamp;
+  }
+}
+
@@ -26,6 +26,7 @@
 #include <unistd.h>
 #include <sys/time.h>
 #include <sys/times.h>
+#include <sys/resource.h>
 #endif
 
 void InitSeed();
@@ -36,10 +37,22 @@ void StopTotalClock();
 void StartRunClock();
 void StopRunClock();
 
+void StartReadClock();
+void StopReadClock();
+
+void CalcPeakRSS();
+
+void StartWallClock();
+void CalcFirstFlipTime();
+
 double TotalTimeElapsed();
 double RunTimeElapsed();
 
 extern double fTotalTime;
 extern double fRunTime;
+extern double fReadTime;
+extern double fFirstFlipTime;
+
+extern UINT32 iPeakRSS;
 
 
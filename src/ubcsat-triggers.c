@@ -94,6 +94,20 @@ void DefaultFlipW();
 void CheckTermination();
 
 
+/***** Trigger ParFlip *****/
+
+void CreateParFlip();
+void ParFlipEvents(BOOL bCritSat);
+void ParFlipFalseClauseList();
+void ParFlipMakeBreak();
+void ParFlipMBPFLandFCLandVIF();
+
+UINT32 iParFlipOcc;
+BOOL bParFlip;
+UINT32 **aParFlipEvents;
+UINT32 aParFlipNumEvents[MAXTHREADS];
+
+
 /***** Trigger FalseClauseList *****/
 /***** Trigger Flip+FalseClauseList[W] *****/
 
@@ -162,6 +176,22 @@ UINT32 *aVarInFalseList;
 UINT32 *aVarInFalseListPos;
 
 
+/***** Trigger ImproveCount *****/
+
+void CreateImproveCount();
+void InitImproveCount();
+void UpdateImproveCount();
+
+SINT32 *aImproveScore;
+FLOAT *aImproveScoreW;
+UINT32 *aImproveCritSat;
+UINT32 iNumImproving;
+UINT32 iNumImprovingW;
+UINT32 iNumImproveZero;
+UINT32 iNumImproveZeroW;
+BOOL bImproveCount;
+
+
 /***** Trigger VarLastChange *****/
 /*
     aVarLastChange[j]     the step # of the most recent time variable[j] was flipped
@@ -217,12 +247,41 @@ void InitDecPromVarsW();
 void UpdateDecPromVarsW();
 
 UINT32 *aDecPromVarsList;
+UINT32 *aDecPromVarsListPos;
+UINT32 *aDecPromVarsSeq;
+UINT32 iDecPromVarsSeq;
 UINT32 iNumDecPromVars;
 
 UINT32 *aDecPromVarsListW;
+UINT32 *aDecPromVarsListPosW;
+UINT32 *aDecPromVarsSeqW;
+UINT32 iDecPromVarsSeqW;
 UINT32 iNumDecPromVarsW;
 
 
+/***** Trigger DecPromBest[W] *****/
+/***** Trigger DecPromOldest *****/
+
+void CreateDecPromBest();
+void InitDecPromBest();
+void UpdateDecPromBest();
+
+void CreateDecPromOldest();
+void InitDecPromOldest();
+void UpdateDecPromOldest();
+
+void CreateDecPromBestW();
+void InitDecPromBestW();
+void UpdateDecPromBestW();
+
+VARHEAP hDecPromBest;
+VARHEAP hDecPromOldest;
+VARHEAP hDecPromBestW;
+
+SINT32 *aDecPromBestScore;
+FLOAT *aDecPromBestScoreW;
+
+
 /***** Trigger BestScoreList *****/
 
 void CreateBestScoreList();
@@ -324,10 +383,18 @@ UINT32 iBestStepSumFalseW;
 /***** Trigger SaveBest *****/
 
 void CreateSaveBest();
+void InitSaveBest();
+void JournalSaveBest();
 void UpdateSaveBest();
 
 VARSTATE vsBest;
 
+UINT32 *aBestJournal;
+UINT32 iNumBestJournal;
+UINT32 iBestJournalLen;
+UINT32 iBestJournalMax;
+BOOL bBestJournalValid;
+
 
 /***** Trigger StartFalse *****/
 
@@ -409,6 +476,60 @@ void CheckTimeout();
 void CheckForRestarts();
 
 
+/***** Trigger RestartPolicy *****/
+
+void SetupRestartPolicy();
+void InitRestartPolicy();
+void StartRestartPolicy();
+void CheckRestartPolicy();
+
+UINT32 iRestartUnit;
+UINT32 iRestartLength;
+UINT32 iRestartLast;
+UINT32 iRestartNum;
+UINT32 iRestartTry;
+
+void NextRestartLuby();
+
+void InitRestartGeometric();
+void NextRestartGeometric();
+
+FLOAT fRestartGeometricLength;
+
+void CreateRestartAdaptive();
+void InitRestartAdaptive();
+void NextRestartAdaptive();
+void UpdateRestartAdaptive();
+
+UINT32 *aRestartAdaptLength;
+BOOL *aRestartAdaptFound;
+FLOAT *aRestartAdaptLogLen;
+UINT32 iNumRestartAdapt;
+UINT32 iNextRestartAdapt;
+UINT32 iNumRestartAdaptFound;
+UINT32 iRestartAdaptAdded;
+UINT32 iRestartAdaptNextFit;
+BOOL bRestartAdaptFitted;
+UINT32 iRestartAdaptCutoff;
+FLOAT fRestartAdaptShape;
+FLOAT fRestartAdaptScale;
+FLOAT fRestartAdaptShift;
+
+
+/***** Trigger IncRestart *****/
+
+void CreateIncRestart();
+void SaveIncRestart();
+void ReplayIncRestart();
+void DoneIncRestart();
+
+UINT32 *aIncRestartPrev;
+UINT32 *aIncRestartDiff;
+BOOL bIncRestartValid;
+BOOL bIncRestartArmed;
+BOOL bIncRestartReplayed;
+
+
 /***** Trigger FlipCounts *****/
 
 void CreateFlipCounts();
@@ -450,9 +571,12 @@ FLOAT fMeanMaxBias;
 
 void CreateUnsatCounts();
 void InitUnsatCounts();
+void SyncUnsatCounts();
 void UpdateUnsatCounts();
+void FinalUnsatCounts();
 
 UINT32 *aUnsatCounts;
+UINT32 *aUnsatCountsSince;
 
 
 /***** Trigger UnsatCountStats *****/
@@ -489,8 +613,10 @@ UINT32 *aDistanceCountsWindow;
 void CreateClauseLast();
 void InitClauseLast();
 void UpdateClauseLast();
+void FinalClauseLast();
 
 UINT32 *aClauseLast;
+UINT32 *aClauseLastSince;
 
 
 /***** Trigger SQGrid *****/
@@ -525,6 +651,13 @@ FLOAT *aPenaltyStatsStddevSum2;
 FLOAT *aPenaltyStatsCVSum;
 FLOAT *aPenaltyStatsCVSum2;
 
+FLOAT *aPenaltyStatsLast;
+FLOAT *aPenaltyStatsNormAt;
+FLOAT *aPenaltyStatsNorm2At;
+FLOAT fPenaltyStatsNorm;
+FLOAT fPenaltyStatsNorm2;
+BOOL bPenaltyStats;
+
 
 /***** Trigger VarFlipHistory *****/
 
@@ -545,6 +678,24 @@ UINT32 *aMobilityWindowVarChange;
 UINT32 *aMobilityWindow;
 FLOAT *aMobilityWindowSum;
 FLOAT *aMobilityWindowSum2;
+UINT32 *aMobilityWindowCount;
+
+
+/***** Trigger MobilityFixed *****/
+
+void CreateMobilityFixed();
+void InitMobilityFixed();
+void UpdateMobilityFixed();
+
+UINT32 iMobilityFixed;
+FLOAT fMobilityFixedSum;
+FLOAT fMobilityFixedSum2;
+UINT32 iMobilityN;
+FLOAT fMobilityNSum;
+FLOAT fMobilityNSum2;
+
+BYTE *aMobilityFixedParity;
+BYTE *aMobilityNParity;
 
 
 /***** Trigger MobilityFixedFrequencies *****/
@@ -573,6 +724,15 @@ FLOAT fAutoCorrSum;
 FLOAT fAutoCorrSum2;
 FLOAT *aAutoCorrCrossSum;
 
+BOOL bAutoCorrFFT;
+UINT32 iAutoCorrBlockLen;
+UINT32 iAutoCorrBlockFill;
+FLOAT *aAutoCorrBlock;
+FLOAT *aAutoCorrFFTRe;
+FLOAT *aAutoCorrFFTIm;
+FLOAT *aAutoCorrFFTCos;
+FLOAT *aAutoCorrFFTSin;
+
 /***** Trigger AutoCorrOne *****/
 
 void InitAutoCorrOne();
@@ -596,6 +756,37 @@ void BranchFactorW();
 FLOAT fBranchFactor;
 FLOAT fBranchFactorW;
 
+/***** Trigger StatSample *****/
+
+void SetupStatSample();
+void InitStatSample();
+void UpdateStatSample();
+
+FLOAT fStatSample;
+BOOL bStatSample;
+BOOL bStatSampleStep;
+UINT32 iStatSampleCount;
+
+UINT32 iStatSampleInterval;
+UINT32 iStatSampleNext;
+FLOAT fStatSampleLogQ;
+UINT32 iStatSampleRand;
+
+/***** Trigger SidewaysCount[W] *****/
+
+void SelectSidewaysCount();
+void InitSidewaysChanges();
+void UpdateSidewaysChanges();
+
+void SelectSidewaysCountW();
+void InitSidewaysChangesW();
+void UpdateSidewaysChangesW();
+
+UINT32 iNumSideways;
+UINT32 iNumSidewaysW;
+BOOL bSidewaysChanges;
+BOOL bSidewaysChangesW;
+
 
 /****** Trigger StepsUpDownSide *****/
 
@@ -630,6 +821,7 @@ void UpdateSolutionDistance();
 
 VARSTATE vsSolutionDistance;
 UINT32 iSolutionDistance;
+UINT32 iSolutionDistanceStep;
 
 
 /***** Trigger FDCRun *****/
@@ -710,6 +902,8 @@ void AddDataTriggers() {
   CreateTrigger("DefaultFlipW",FlipCandidate,DefaultFlipW,"","");
 
   CreateTrigger("CheckTermination",CheckTerminate,CheckTermination,"","");
+
+  CreateTrigger("ParFlip",CreateStateInfo,CreateParFlip,"","");
   
   CreateContainerTrigger("DefaultProcedures","ReadCNF,LitOccurence,CandidateList,InitVarsFromFile,DefaultStateInfo,DefaultInitVars,DefaultFlip,CheckTermination");
   CreateContainerTrigger("DefaultProceduresW","ReadCNF,LitOccurence,CandidateList,InitVarsFromFile,DefaultStateInfo,DefaultInitVars,DefaultFlipW,CheckTermination");
@@ -745,6 +939,11 @@ void AddDataTriggers() {
   CreateContainerTrigger("MakeBreakW","CreateMakeBreakW,InitMakeBreakW,UpdateMakeBreakW");
   CreateTrigger("Flip+MakeBreakW",FlipCandidate,FlipMakeBreakW,"MakeBreakW","DefaultFlipW,UpdateMakeBreakW");
 
+  CreateTrigger("CreateImproveCount",CreateStateInfo,CreateImproveCount,"","");
+  CreateTrigger("InitImproveCount",InitStateInfo,InitImproveCount,"InitDefaultStateInfo","");
+  CreateTrigger("UpdateImproveCount",UpdateStateInfo,UpdateImproveCount,"","");
+  CreateContainerTrigger("ImproveCount","CreateImproveCount,InitImproveCount,UpdateImproveCount");
+
   CreateTrigger("CreateVarInFalse",CreateStateInfo,CreateVarInFalse,"CreateMakeBreak","");
   CreateTrigger("InitVarInFalse",InitStateInfo,InitVarInFalse,"InitMakeBreak","");
   CreateTrigger("UpdateVarInFalse",UpdateStateInfo,UpdateVarInFalse,"","UpdateMakeBreak");
@@ -777,11 +976,26 @@ void AddDataTriggers() {
   CreateTrigger("UpdateDecPromVars",UpdateStateInfo,UpdateDecPromVars,"UpdateTrackChanges","");
   CreateContainerTrigger("DecPromVars","CreateDecPromVars,InitDecPromVars,UpdateDecPromVars");
 
+  CreateTrigger("CreateDecPromBest",CreateStateInfo,CreateDecPromBest,"CreateDecPromVars","");
+  CreateTrigger("InitDecPromBest",InitStateInfo,InitDecPromBest,"InitDecPromVars,InitVarLastChange","");
+  CreateTrigger("UpdateDecPromBest",UpdateStateInfo,UpdateDecPromBest,"UpdateDecPromVars","");
+  CreateContainerTrigger("DecPromBest","CreateDecPromBest,InitDecPromBest,UpdateDecPromBest");
+
+  CreateTrigger("CreateDecPromOldest",CreateStateInfo,CreateDecPromOldest,"CreateDecPromVars","");
+  CreateTrigger("InitDecPromOldest",InitStateInfo,InitDecPromOldest,"InitDecPromVars,InitVarLastChange","");
+  CreateTrigger("UpdateDecPromOldest",UpdateStateInfo,UpdateDecPromOldest,"UpdateDecPromVars","");
+  CreateContainerTrigger("DecPromOldest","CreateDecPromOldest,InitDecPromOldest,UpdateDecPromOldest");
+
   CreateTrigger("CreateDecPromVarsW",CreateStateInfo,CreateDecPromVarsW,"CreateTrackChangesW","");
   CreateTrigger("InitDecPromVarsW",InitStateInfo,InitDecPromVarsW,"InitTrackChangesW","");
   CreateTrigger("UpdateDecPromVarsW",UpdateStateInfo,UpdateDecPromVarsW,"UpdateTrackChangesW","");
   CreateContainerTrigger("DecPromVarsW","CreateDecPromVarsW,InitDecPromVarsW,UpdateDecPromVarsW");
 
+  CreateTrigger("CreateDecPromBestW",CreateStateInfo,CreateDecPromBestW,"CreateDecPromVarsW","");
+  CreateTrigger("InitDecPromBestW",InitStateInfo,InitDecPromBestW,"InitDecPromVarsW,InitVarLastChange","");
+  CreateTrigger("UpdateDecPromBestW",UpdateStateInfo,UpdateDecPromBestW,"UpdateDecPromVarsW","");
+  CreateContainerTrigger("DecPromBestW","CreateDecPromBestW,InitDecPromBestW,UpdateDecPromBestW");
+
   CreateTrigger("CreateBestScoreList",CreateStateInfo,CreateBestScoreList,"","");
   CreateTrigger("InitBestScoreList",InitStateInfo,InitBestScoreList,"InitVarScore","");
   CreateTrigger("UpdateBestScoreList",UpdateStateInfo,UpdateBestScoreList,"","");
@@ -818,7 +1032,7 @@ void AddDataTriggers() {
   CreateContainerTrigger("NullFlips","InitNullFlips,UpdateNullFlips");
 
   CreateTrigger("InitLocalMins",PreRun,InitLocalMins,"","");
-  CreateTrigger("UpdateLocalMins",UpdateStateInfo,UpdateLocalMins,"","");
+  CreateTrigger("UpdateLocalMins",UpdateStateInfo,UpdateLocalMins,"ImproveCount","");
   CreateContainerTrigger("LocalMins","InitLocalMins,UpdateLocalMins");
 
   CreateTrigger("LogDist",CreateData,CreateLogDist,"","");
@@ -828,15 +1042,17 @@ void AddDataTriggers() {
   CreateContainerTrigger("BestFalse","InitBestFalse,UpdateBestFalse");
 
   CreateTrigger("CreateSaveBest",CreateStateInfo,CreateSaveBest,"","");
+  CreateTrigger("InitSaveBest",InitStateInfo,InitSaveBest,"","");
+  CreateTrigger("JournalSaveBest",FlipCandidate,JournalSaveBest,"","");
   CreateTrigger("UpdateSaveBest",PostStep,UpdateSaveBest,"BestFalse","");
-  CreateContainerTrigger("SaveBest","CreateSaveBest,UpdateSaveBest");
+  CreateContainerTrigger("SaveBest","CreateSaveBest,InitSaveBest,JournalSaveBest,UpdateSaveBest");
 
   CreateTrigger("StartFalse",PostStep,UpdateStartFalse,"","");
 
   CreateTrigger("ImproveMean",RunCalculations,CalcImproveMean,"StartFalse,BestFalse","");
 
   CreateTrigger("InitFirstLM",PreRun,InitFirstLM,"","");
-  CreateTrigger("UpdateFirstLM",PostStep,UpdateFirstLM,"","");
+  CreateTrigger("UpdateFirstLM",PostStep,UpdateFirstLM,"ImproveCount","");
   CreateContainerTrigger("FirstLM","InitFirstLM,UpdateFirstLM");
 
   CreateTrigger("FirstLMRatio",RunCalculations,CalcFirstLMRatio,"FirstLM,StartFalse,BestFalse","");
@@ -857,6 +1073,31 @@ void AddDataTriggers() {
 
   CreateTrigger("CheckForRestarts",CheckRestart,CheckForRestarts,"","");
 
+  CreateTrigger("SetupRestartPolicy",PostParameters,SetupRestartPolicy,"","");
+  CreateTrigger("InitRestartPolicy",PreRun,InitRestartPolicy,"","");
+  CreateTrigger("StartRestartPolicy",PreInit,StartRestartPolicy,"","");
+  CreateTrigger("CheckRestartPolicy",CheckRestart,CheckRestartPolicy,"","");
+  CreateContainerTrigger("RestartPolicy","SetupRestartPolicy,InitRestartPolicy,StartRestartPolicy,CheckRestartPolicy");
+
+  CreateTrigger("NextRestartLuby",PreInit,NextRestartLuby,"StartRestartPolicy","");
+  CreateContainerTrigger("RestartLuby","NextRestartLuby");
+
+  CreateTrigger("InitRestartGeometric",PreRun,InitRestartGeometric,"","");
+  CreateTrigger("NextRestartGeometric",PreInit,NextRestartGeometric,"StartRestartPolicy","");
+  CreateContainerTrigger("RestartGeometric","InitRestartGeometric,NextRestartGeometric");
+
+  CreateTrigger("CreateRestartAdaptive",PreStart,CreateRestartAdaptive,"","");
+  CreateTrigger("InitRestartAdaptive",PreRun,InitRestartAdaptive,"","");
+  CreateTrigger("NextRestartAdaptive",PreInit,NextRestartAdaptive,"StartRestartPolicy","");
+  CreateTrigger("UpdateRestartAdaptive",RunCalculations,UpdateRestartAdaptive,"","");
+  CreateContainerTrigger("RestartAdaptive","CreateRestartAdaptive,InitRestartAdaptive,NextRestartAdaptive,UpdateRestartAdaptive");
+
+  CreateTrigger("CreateIncRestart",CreateStateInfo,CreateIncRestart,"","");
+  CreateTrigger("SaveIncRestart",PreInit,SaveIncRestart,"","");
+  CreateTrigger("ReplayIncRestart",InitStateInfo,ReplayIncRestart,"","");
+  CreateTrigger("DoneIncRestart",PostInit,DoneIncRestart,"","");
+  CreateContainerTrigger("IncRestart","CreateIncRestart,SaveIncRestart,ReplayIncRestart,DoneIncRestart");
+
   CreateTrigger("CreateFlipCounts",CreateStateInfo,CreateFlipCounts,"","");
   CreateTrigger("InitFlipCounts",InitStateInfo,InitFlipCounts,"","");
   CreateTrigger("UpdateFlipCounts",UpdateStateInfo,UpdateFlipCounts,"","");
@@ -874,26 +1115,29 @@ void AddDataTriggers() {
 
   CreateTrigger("CreateUnsatCounts",CreateStateInfo,CreateUnsatCounts,"","");
   CreateTrigger("InitUnsatCounts",InitStateInfo,InitUnsatCounts,"","");
-  CreateTrigger("UpdateUnsatCounts",PostStep,UpdateUnsatCounts,"","");
-  CreateContainerTrigger("UnsatCounts","CreateUnsatCounts,InitUnsatCounts,UpdateUnsatCounts");
+  CreateTrigger("SyncUnsatCounts",InitStateInfo,SyncUnsatCounts,"InitUnsatCounts,InitDefaultStateInfo","");
+  CreateTrigger("UpdateUnsatCounts",UpdateStateInfo,UpdateUnsatCounts,"","");
+  CreateTrigger("FinalUnsatCounts",RunCalculations,FinalUnsatCounts,"","");
+  CreateContainerTrigger("UnsatCounts","CreateUnsatCounts,InitUnsatCounts,SyncUnsatCounts,UpdateUnsatCounts,FinalUnsatCounts");
 
   CreateTrigger("UnsatCountStats",RunCalculations,UnsatCountStats,"UnsatCounts","");
 
   CreateTrigger("CreateNumFalseCounts",CreateStateInfo,CreateNumFalseCounts,"","");
   CreateTrigger("InitNumFalseCounts",InitStateInfo,InitNumFalseCounts,"","");
-  CreateTrigger("UpdateNumFalseCounts",PostStep,UpdateNumFalseCounts,"","");
+  CreateSampledTrigger("UpdateNumFalseCounts",PostStep,UpdateNumFalseCounts,"","");
   CreateContainerTrigger("NumFalseCounts","CreateNumFalseCounts,InitNumFalseCounts,UpdateNumFalseCounts");
 
   CreateTrigger("CreateDistanceCounts",CreateStateInfo,CreateDistanceCounts,"","");
   CreateTrigger("InitDistanceCounts",InitStateInfo,InitDistanceCounts,"","");
-  CreateTrigger("UpdateDistanceCounts",PostStep,UpdateDistanceCounts,"","");
+  CreateSampledTrigger("UpdateDistanceCounts",PostStep,UpdateDistanceCounts,"","");
   CreateContainerTrigger("DistanceCounts","CreateDistanceCounts,InitDistanceCounts,UpdateDistanceCounts,SolutionDistance");
 
   CreateTrigger("UnsatCountStats",RunCalculations,UnsatCountStats,"UnsatCounts","");
   CreateTrigger("CreateClauseLast",CreateStateInfo,CreateClauseLast,"","");
-  CreateTrigger("InitClauseLast",InitStateInfo,InitClauseLast,"","");
-  CreateTrigger("UpdateClauseLast",PostStep,UpdateClauseLast,"","");
-  CreateContainerTrigger("ClauseLast","CreateClauseLast,InitClauseLast,UpdateClauseLast");
+  CreateTrigger("InitClauseLast",InitStateInfo,InitClauseLast,"InitDefaultStateInfo","");
+  CreateTrigger("UpdateClauseLast",UpdateStateInfo,UpdateClauseLast,"","");
+  CreateTrigger("FinalClauseLast",RunCalculations,FinalClauseLast,"","");
+  CreateContainerTrigger("ClauseLast","CreateClauseLast,InitClauseLast,UpdateClauseLast,FinalClauseLast");
 
   CreateTrigger("CreateSQGrid",CreateStateInfo,CreateSQGrid,"LogDist","");
   CreateTrigger("InitSQGrid",PreRun,InitSQGrid,"","");
@@ -916,9 +1160,14 @@ void AddDataTriggers() {
   CreateTrigger("UpdateMobilityWindow",PostStep,UpdateMobilityWindow,"UpdateVarFlipHistory","");
   CreateContainerTrigger("MobilityWindow","CreateMobilityWindow,InitMobilityWindow,UpdateMobilityWindow");
 
-  CreateTrigger("CreateMobilityFixedFrequencies",PreStart,CreateMobilityFixedFrequencies,"CreateMobilityWindow","");
-  CreateTrigger("InitMobilityFixedFrequencies",PreRun,InitMobilityFixedFrequencies,"InitMobilityWindow","");
-  CreateTrigger("UpdateMobilityFixedFrequencies",PostStep,UpdateMobilityFixedFrequencies,"UpdateMobilityWindow","");
+  CreateTrigger("CreateMobilityFixed",PreStart,CreateMobilityFixed,"CreateVarFlipHistory","");
+  CreateTrigger("InitMobilityFixed",PreRun,InitMobilityFixed,"","");
+  CreateTrigger("UpdateMobilityFixed",PostStep,UpdateMobilityFixed,"UpdateVarFlipHistory","");
+  CreateContainerTrigger("MobilityFixed","CreateMobilityFixed,InitMobilityFixed,UpdateMobilityFixed");
+
+  CreateTrigger("CreateMobilityFixedFrequencies",PreStart,CreateMobilityFixedFrequencies,"CreateMobilityFixed","");
+  CreateTrigger("InitMobilityFixedFrequencies",PreRun,InitMobilityFixedFrequencies,"InitMobilityFixed","");
+  CreateTrigger("UpdateMobilityFixedFrequencies",PostStep,UpdateMobilityFixedFrequencies,"UpdateMobilityFixed","");
   CreateContainerTrigger("MobilityFixedFrequencies","CreateMobilityFixedFrequencies,InitMobilityFixedFrequencies,UpdateMobilityFixedFrequencies");
 
   CreateTrigger("CreateAutoCorr",PreStart,CreateAutoCorr,"","");
@@ -932,8 +1181,23 @@ void AddDataTriggers() {
   CreateTrigger("CalcAutoCorrOne",RunCalculations,CalcAutoCorrOne,"","");
   CreateContainerTrigger("AutoCorrOne","InitAutoCorrOne,UpdateAutoCorrOne,CalcAutoCorrOne");
 
-  CreateTrigger("BranchFactor",PostStep,BranchFactor,"VarScore","");
-  CreateTrigger("BranchFactorW",PostStep,BranchFactorW,"VarScoreW,CheckWeighted","");
+  CreateTrigger("SetupStatSample",PreStart,SetupStatSample,"","");
+  CreateTrigger("InitStatSample",PreRun,InitStatSample,"","");
+  CreateTrigger("UpdateStatSample",PreStep,UpdateStatSample,"","");
+  CreateContainerTrigger("StatSample","SetupStatSample,InitStatSample,UpdateStatSample");
+
+  CreateTrigger("SelectSidewaysCount",PostParameters,SelectSidewaysCount,"","");
+  CreateTrigger("InitSidewaysChanges",InitStateInfo,InitSidewaysChanges,"InitVarScore","");
+  CreateTrigger("UpdateSidewaysChanges",UpdateStateInfo,UpdateSidewaysChanges,"TrackChanges","");
+  CreateContainerTrigger("SidewaysChanges","InitSidewaysChanges,UpdateSidewaysChanges");
+
+  CreateTrigger("SelectSidewaysCountW",PostParameters,SelectSidewaysCountW,"","");
+  CreateTrigger("InitSidewaysChangesW",InitStateInfo,InitSidewaysChangesW,"InitVarScoreW","");
+  CreateTrigger("UpdateSidewaysChangesW",UpdateStateInfo,UpdateSidewaysChangesW,"TrackChangesW","");
+  CreateContainerTrigger("SidewaysChangesW","InitSidewaysChangesW,UpdateSidewaysChangesW");
+
+  CreateTrigger("BranchFactor",PostStep,BranchFactor,"SelectSidewaysCount","");
+  CreateTrigger("BranchFactorW",PostStep,BranchFactorW,"SelectSidewaysCountW,CheckWeighted","");
 
   CreateTrigger("InitStepsUpDownSide",PreRun,InitStepsUpDownSide,"","");
   CreateTrigger("UpdateStepsUpDownSide",PostStep,UpdateStepsUpDownSide,"","");
@@ -944,11 +1208,11 @@ void AddDataTriggers() {
   CreateTrigger("LoadKnownSolutions",CreateStateInfo,LoadKnownSolutions,"","");
 
   CreateTrigger("CreateSolutionDistance",CreateStateInfo,CreateSolutionDistance,"","");
-  CreateTrigger("UpdateSolutionDistance",PostStep,UpdateSolutionDistance,"","");
+  CreateSampledTrigger("UpdateSolutionDistance",PostStep,UpdateSolutionDistance,"","");
   CreateContainerTrigger("SolutionDistance","CreateSolutionDistance,UpdateSolutionDistance,LoadKnownSolutions");
 
   CreateTrigger("InitFDCRun",PreRun,InitFDCRun,"","");
-  CreateTrigger("UpdateFDCRun",UpdateStateInfo,UpdateFDCRun,"UpdateSolutionDistance","");
+  CreateTrigger("UpdateFDCRun",UpdateStateInfo,UpdateFDCRun,"UpdateSolutionDistance,ImproveCount","");
   CreateTrigger("CalcFDCRun",RunCalculations,CalcFDCRun,"","");
   CreateContainerTrigger("FDCRun","InitFDCRun,UpdateFDCRun,CalcFDCRun,SolutionDistance,LoadKnownSolutions");
 
@@ -958,6 +1222,40 @@ void AddDataTriggers() {
 
   CreateTrigger("FileAbort",PostRun,FileAbort,"","");
 
+  CreateTrigger("CatchSignals",PreStart,CatchSignals,"","");
+
+  CreateTrigger("InitCheckpoint",PreStart,InitCheckpoint,"","");
+  CreateTrigger("WriteCheckpointStep",PostStep,WriteCheckpointStep,"","");
+  CreateTrigger("WriteCheckpointFinal",FinalCalculations,WriteCheckpointFinal,"","");
+  CreateContainerTrigger("WriteCheckpoint","CatchSignals,InitCheckpoint,WriteCheckpointStep,WriteCheckpointFinal");
+
+  CreateTrigger("LoadCheckpoint",PreStart,LoadCheckpoint,"","");
+  CreateTrigger("ResumeCheckpointRun",PostInit,ResumeCheckpointRun,"","");
+  CreateContainerTrigger("ResumeCheckpoint","LoadCheckpoint,ResumeCheckpointRun");
+
+  CreateTrigger("StartCoop",PreStart,StartCoop,"","");
+  CreateTrigger("InitCoopRun",PreRun,InitCoopRun,"","");
+  CreateTrigger("UpdateCoop",PostFlip,UpdateCoop,"","");
+  CreateTrigger("StopCoop",FinalCalculations,StopCoop,"","");
+  CreateContainerTrigger("Coop","StartCoop,InitCoopRun,UpdateCoop,StopCoop,SaveBest,BestFalse");
+
+  CreateTrigger("SetupFarm",PostParameters,SetupFarm,"","");
+  CreateTrigger("StartFarm",PreStart,StartFarm,"","");
+  CreateTrigger("FarmRun",PreRun,FarmRun,"","");
+  CreateTrigger("FarmStep",PostStep,FarmStep,"","");
+  CreateTrigger("FarmResult",PostRun,FarmResult,"ColumnRunCalculation","");
+  CreateTrigger("StopFarm",FinalCalculations,StopFarm,"","");
+  CreateContainerTrigger("Farm","SetupFarm,StartFarm,FarmRun,FarmStep,FarmResult,StopFarm");
+
+  CreateTrigger("SetupBatch",PostParameters,SetupBatch,"","ReportOut,ReportStats");
+  CreateContainerTrigger("Batch","SetupBatch,ReportBatch");
+
+  CreateTrigger("SetupServe",PostParameters,SetupServe,"","ReportOut,ReportStats");
+  CreateTrigger("InitServeBest",PostRead,InitServeBest,"","");
+  CreateTrigger("UpdateServeBest",PostRun,UpdateServeBest,"","");
+  CreateTrigger("ServeReply",FinalReports,ServeReply,"","");
+  CreateContainerTrigger("Serve","SetupServe,InitServeBest,UpdateServeBest,ServeReply,ReportBatch,CheckTimeout,SaveBest,BestFalse");
+
   CreateTrigger("DynamicParms",PostRead,DynamicParms,"","");
 
   CreateTrigger("FlushBuffers",PreRun,FlushBuffers,"","");
@@ -994,10 +1292,16 @@ void ReadCNF() {
 
   iNumClauses = 0;
 
-  SetupFile(&filInput,"r",sFilenameIn,stdin,0);
+  if (bServeMode) {
+    filInput = filServeIn;
+  } else {
+    SetupFile(&filInput,"r",sFilenameIn,stdin,0);
+  }
 
   while (iNumClauses == 0) {
-    fgets(sLine,MAXCNFLINELEN,filInput);
+    if (fgets(sLine,MAXCNFLINELEN,filInput) == NULL) {
+      break;
+    }
     if (strlen(sLine)==MAXCNFLINELEN-1) {
       ReportPrint1(pRepErr,"Unexpected Error: increase constant MAXCNFLINELEN [%u]\n",MAXCNFLINELEN);
       AbnormalExit();
@@ -1072,7 +1376,7 @@ void ReadCNF() {
     aClauseLen[j] = 0;
 
     do {
-      iScanRet = fscanf(filInput,"%d",&l);
+      iScanRet = fscanf(filInput,"%ld",&l);
 
       while (iScanRet != 1) {
         if (iScanRet==0) {
@@ -1080,7 +1384,7 @@ void ReadCNF() {
 
           if (sLine[0] =='c') {
             ReportPrint1(pRepErr,"Warning: Ingoring comment line mid instance:\n   %s",sLine);
-            iScanRet = fscanf(filInput,"%d",&l);
+            iScanRet = fscanf(filInput,"%ld",&l);
           } else {
             ReportPrint1(pRepErr,"Error reading instance at clause [%u]\n",j);
             ReportPrint1(pRepErr,"  at or near: %s\n",sLine);
@@ -1108,7 +1412,7 @@ void ReadCNF() {
         *pNextLit = SetLitFromFile(l);
 
         if (GetVarFromLit(*pNextLit) > iNumVars) {
-          ReportPrint2(pRepErr,"Error: Invalid Literal [%d] in clause [%u]\n",l,j);
+          ReportPrint2(pRepErr,"Error: Invalid Literal [%ld] in clause [%u]\n",l,j);
           AbnormalExit();
         }
 
@@ -1126,20 +1430,92 @@ void ReadCNF() {
 
   AdjustLastRAM((pNextLit - pData) * sizeof(LITTYPE));
 
-  CloseSingleFile(filInput);  
+  if (!bServeMode) {
+    CloseSingleFile(filInput);
+  }
+
+}
+
+/*
+    with more than one thread, each thread counts the literals of a block
+    of clauses, and a prefix sum over (literal,thread) gives each thread
+    the position of its first clause in each literal occurrence list, so
+    the lists are identical (sorted by clause) to the single pass
+*/
+
+UINT32 *aLitOccThreadCount;
+
+void CountLitOccurenceBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 j,k;
+  LITTYPE *pLit;
+  UINT32 *aCount;
+
+  aCount = &aLitOccThreadCount[iThread*(iNumVars+1)*2];
+  memset(aCount,0,(iNumVars+1)*2*sizeof(UINT32));
 
+  for (j=iFirst;j<iLast;j++) {
+    pLit = pClauseLits[j];
+    for (k=0;k<aClauseLen[j];k++) {
+      aCount[*pLit]++;
+      pLit++;
+    }
+  }
+}
+
+void FillLitOccurenceBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 j,k;
+  LITTYPE *pLit;
+  UINT32 *aNext;
+
+  aNext = &aLitOccThreadCount[iThread*(iNumVars+1)*2];
+
+  for (j=iFirst;j<iLast;j++) {
+    pLit = pClauseLits[j];
+    for (k=0;k<aClauseLen[j];k++) {
+      aLitOccData[aNext[*pLit]++] = j;
+      pLit++;
+    }
+  }
 }
 
 void CreateLitOccurence() {
 
   UINT32 j,k;
+  UINT32 iBlocks;
+  UINT32 iCount;
   LITTYPE *pLit;
   LITTYPE *pCur;
+  UINT32 iPos;
 
   aNumLitOcc = AllocateRAM((iNumVars+1)*2*sizeof(UINT32));
   pLitClause = AllocateRAM((iNumVars+1)*2*sizeof(UINT32 *));
   aLitOccData = AllocateRAM(iNumLits*sizeof(UINT32));
 
+  iBlocks = ParallelBlocks(iNumClauses);
+
+  if (iBlocks > 1) {
+
+    aLitOccThreadCount = AllocateRAM(iBlocks*(iNumVars+1)*2*sizeof(UINT32));
+
+    ParallelFor(iNumClauses,CountLitOccurenceBlock);
+
+    iPos = 0;
+    for (j=0;j<(iNumVars+1)*2;j++) {
+      pLitClause[j] = &aLitOccData[iPos];
+      aNumLitOcc[j] = 0;
+      for (k=0;k<iBlocks;k++) {
+        iCount = aLitOccThreadCount[k*(iNumVars+1)*2 + j];
+        aLitOccThreadCount[k*(iNumVars+1)*2 + j] = iPos;
+        aNumLitOcc[j] += iCount;
+        iPos += iCount;
+      }
+    }
+
+    ParallelFor(iNumClauses,FillLitOccurenceBlock);
+
+    return;
+  }
+
   memset(aNumLitOcc,0,(iNumVars+1)*2*sizeof(UINT32));
   
   for (j=0;j<iNumClauses;j++) {
@@ -1207,7 +1583,7 @@ void InitVarsFromFile() {
             } else {
               *pPos++=0;
 
-              sscanf(pStart,"%d",&iLit);
+              sscanf(pStart,"%ld",&iLit);
 
               if (iLit) {
                 if (iLit > 0) {
@@ -1235,7 +1611,7 @@ void InitVarsFromFile() {
           }
 
           if (strlen(pStart)) {
-            sscanf(pStart,"%d",&iLit);
+            sscanf(pStart,"%ld",&iLit);
 
             if (iLit) {
               if (iLit > 0) {
@@ -1261,26 +1637,77 @@ void CreateDefaultStateInfo() {
   aVarInit = AllocateRAM((iNumVars+1)*sizeof(UINT32));
 }
 
+/*
+    with more than one thread, aNumTrueLit[] is counted one clause at a time,
+    so that blocks of clauses can be counted in parallel (each thread has
+    its own false count, and fSumFalseW is still summed in clause order)
+*/
+
+UINT32 aThreadNumFalse[MAXTHREADS];
+
+void InitTrueLitBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 j,k;
+  UINT32 iNumTrue;
+  UINT32 iFalse;
+  LITTYPE *pLit;
+
+  iFalse = 0;
+
+  for (j=iFirst;j<iLast;j++) {
+    iNumTrue = 0;
+    pLit = pClauseLits[j];
+    for (k=0;k<aClauseLen[j];k++) {
+      iNumTrue += IsLitTrue(*pLit);
+      pLit++;
+    }
+    aNumTrueLit[j] = iNumTrue;
+    if (iNumTrue==0) {
+      iFalse++;
+    }
+  }
+
+  aThreadNumFalse[iThread] = iFalse;
+}
+
 void InitDefaultStateInfo() {
   UINT32 j,k;
+  UINT32 iBlocks;
   LITTYPE litCur;
   UINT32 *pClause;
-  
-  memset(aNumTrueLit,0,iNumClauses*sizeof(UINT32));
-  iNumFalse = 0;
 
-  for (j=1;j<=iNumVars;j++) {
-    litCur = GetTrueLit(j);
-    pClause = pLitClause[litCur];
-    for (k=0;k<aNumLitOcc[litCur];k++) {
-      aNumTrueLit[*pClause]++;
-      pClause++;
-      }
+  if (bIncRestartReplayed) {
+    return;
+  }
+
+  iBlocks = ParallelBlocks(iNumClauses);
+
+  if (iBlocks > 1) {
+
+    ParallelFor(iNumClauses,InitTrueLitBlock);
+
+    iNumFalse = 0;
+    for (j=0;j<iBlocks;j++) {
+      iNumFalse += aThreadNumFalse[j];
     }
 
-  for (j=0;j<iNumClauses;j++) {
-    if (aNumTrueLit[j]==0) {
-      iNumFalse++;
+  } else {
+
+    memset(aNumTrueLit,0,iNumClauses*sizeof(UINT32));
+    iNumFalse = 0;
+
+    for (j=1;j<=iNumVars;j++) {
+      litCur = GetTrueLit(j);
+      pClause = pLitClause[litCur];
+      for (k=0;k<aNumLitOcc[litCur];k++) {
+        aNumTrueLit[*pClause]++;
+        pClause++;
+        }
+      }
+
+    for (j=0;j<iNumClauses;j++) {
+      if (aNumTrueLit[j]==0) {
+        iNumFalse++;
+      }
     }
   }
 
@@ -1429,6 +1856,160 @@ void DefaultFlipW() {
   }
 }
 
+/*
+    parallel flips (-parflip)
+
+    when the flipped variable occurs in at least iParFlipOcc clauses, its
+    occurrence lists are split across the thread pool: each thread updates
+    aNumTrueLit (and aCritSat) for its share of the clauses and records the
+    clauses that change state as events.  The flip trigger then replays the
+    events (in occurrence order) to update the false clause list and the
+    variable information, so the results are identical to a serial flip.
+
+    a clause that contains a variable more than once could be updated by
+    two threads at once, so parallel flips are disabled for those instances
+*/
+
+#define PARFLIPFALSE 0
+#define PARFLIPCRIT 1
+#define PARFLIPTRUE 2
+#define PARFLIPUNCRIT 3
+
+#define GetParFlipClause(E) ((E) >> 2)
+#define GetParFlipType(E) ((E) & 3)
+
+#define IsParFlip(V) ((bParFlip) && (aNumLitOcc[GetPosLit(V)] + aNumLitOcc[GetNegLit(V)] >= iParFlipOcc))
+
+UINT32 *pParFlipTrueOcc;
+UINT32 *pParFlipFalseOcc;
+UINT32 iParFlipNumTrueOcc;
+BOOL bParFlipCritSat;
+
+void CreateParFlip() {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 iVar;
+  UINT32 iOcc;
+  UINT32 iMaxOcc;
+  UINT32 iBlockSize;
+  UINT32 *aVarStamp;
+  LITTYPE *pLit;
+
+  bParFlip = FALSE;
+
+  if ((iParFlipOcc == 0) || (iNumThreads < 2)) {
+    return;
+  }
+
+  aVarStamp = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  memset(aVarStamp,0,(iNumVars+1) * sizeof(UINT32));
+
+  for (j=0;j<iNumClauses;j++) {
+    pLit = pClauseLits[j];
+    for (k=0;k<aClauseLen[j];k++) {
+      iVar = GetVarFromLit(*pLit);
+      if (aVarStamp[iVar] == j + 1) {
+        ReportPrint1(pRepErr,"Warning: clause [%u] contains a variable more than once (-parflip is disabled)\n",j + 1);
+        return;
+      }
+      aVarStamp[iVar] = j + 1;
+      pLit++;
+    }
+  }
+
+  iMaxOcc = 0;
+  for (j=1;j<=iNumVars;j++) {
+    iOcc = aNumLitOcc[GetPosLit(j)] + aNumLitOcc[GetNegLit(j)];
+    if (iOcc > iMaxOcc) {
+      iMaxOcc = iOcc;
+    }
+  }
+
+  if (iMaxOcc < iParFlipOcc) {
+    return;
+  }
+
+  StartThreadPool();
+
+  if (iNumPoolThreads < 2) {
+    return;
+  }
+
+  iBlockSize = (iMaxOcc + iNumPoolThreads - 1) / iNumPoolThreads;
+
+  aParFlipEvents = AllocateRAM(iNumPoolThreads * sizeof(UINT32 *));
+  for (j=0;j<iNumPoolThreads;j++) {
+    aParFlipEvents[j] = AllocateRAM(iBlockSize * sizeof(UINT32));
+  }
+
+  bParFlip = TRUE;
+}
+
+void ParFlipBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 iClause;
+  UINT32 iNumEvents;
+  UINT32 *aEvents;
+  LITTYPE *pLit;
+
+  aEvents = aParFlipEvents[iThread];
+  iNumEvents = 0;
+
+  for (j=iFirst;(j<iLast)&&(j<iParFlipNumTrueOcc);j++) {
+    iClause = pParFlipTrueOcc[j];
+    aNumTrueLit[iClause]--;
+    if (aNumTrueLit[iClause]==0) {
+      aEvents[iNumEvents++] = (iClause << 2) | PARFLIPFALSE;
+    } else if ((aNumTrueLit[iClause]==1)&&(bParFlipCritSat)) {
+      pLit = pClauseLits[iClause];
+      for (k=0;k<aClauseLen[iClause];k++) {
+        if (IsLitTrue(*pLit)) {
+          aCritSat[iClause] = GetVarFromLit(*pLit);
+          break;
+        }
+        pLit++;
+      }
+      aEvents[iNumEvents++] = (iClause << 2) | PARFLIPCRIT;
+    }
+  }
+
+  for (;j<iLast;j++) {
+    iClause = pParFlipFalseOcc[j - iParFlipNumTrueOcc];
+    aNumTrueLit[iClause]++;
+    if (aNumTrueLit[iClause]==1) {
+      if (bParFlipCritSat) {
+        aCritSat[iClause] = iFlipCandidate;
+      }
+      aEvents[iNumEvents++] = (iClause << 2) | PARFLIPTRUE;
+    } else if ((aNumTrueLit[iClause]==2)&&(bParFlipCritSat)) {
+      aEvents[iNumEvents++] = (iClause << 2) | PARFLIPUNCRIT;
+    }
+  }
+
+  aParFlipNumEvents[iThread] = iNumEvents;
+}
+
+void ParFlipEvents(BOOL bCritSat) {
+
+  LITTYPE litWasTrue;
+  LITTYPE litWasFalse;
+
+  litWasTrue = GetTrueLit(iFlipCandidate);
+  litWasFalse = GetFalseLit(iFlipCandidate);
+
+  aVarValue[iFlipCandidate] = 1 - aVarValue[iFlipCandidate];
+
+  pParFlipTrueOcc = pLitClause[litWasTrue];
+  pParFlipFalseOcc = pLitClause[litWasFalse];
+  iParFlipNumTrueOcc = aNumLitOcc[litWasTrue];
+  bParFlipCritSat = bCritSat;
+
+  PoolFor(aNumLitOcc[litWasTrue] + aNumLitOcc[litWasFalse],ParFlipBlock);
+}
+
 void CheckTermination() {
   if (iNumFalse <= iTarget) {
     bSolutionFound = TRUE;
@@ -1491,6 +2072,30 @@ void UpdateFalseClauseList() {
   }
 }
 
+void ParFlipFalseClauseList() {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 iClause;
+  UINT32 *aEvents;
+
+  ParFlipEvents(FALSE);
+
+  for (j=0;j<iNumPoolThreads;j++) {
+    aEvents = aParFlipEvents[j];
+    for (k=0;k<aParFlipNumEvents[j];k++) {
+      iClause = GetParFlipClause(aEvents[k]);
+      if (GetParFlipType(aEvents[k]) == PARFLIPFALSE) {
+        aFalseList[iNumFalse] = iClause;
+        aFalseListPos[iClause] = iNumFalse++;
+      } else {
+        aFalseList[aFalseListPos[iClause]] = aFalseList[--iNumFalse];
+        aFalseListPos[aFalseList[iNumFalse]] = aFalseListPos[iClause];
+      }
+    }
+  }
+}
+
 void FlipFalseClauseList() {
 
   UINT32 j;
@@ -1502,6 +2107,11 @@ void FlipFalseClauseList() {
     return;
   }
 
+  if (IsParFlip(iFlipCandidate)) {
+    ParFlipFalseClauseList();
+    return;
+  }
+
   litWasTrue = GetTrueLit(iFlipCandidate);
   litWasFalse = GetFalseLit(iFlipCandidate);
 
@@ -1567,25 +2177,97 @@ void FlipFalseClauseListW() {
   }
 }
 
-void CreateVarScore() {
-  aVarScore = AllocateRAM((iNumVars+1)*sizeof(SINT32));
-  aCritSat = AllocateRAM(iNumClauses*sizeof(UINT32));
-}
+/*
+    with more than one thread, the score (and make/break) builders are
+    split into two passes that can each run in parallel: aCritSat[] is set one clause at a time, and then
+    each variable sums its own literal occurrences, in clause order (so
+    even the FLOAT sums are identical to a single pass over the clauses)
 
-void InitVarScore() {
-  UINT32 j;
-  UINT32 k;
-  UINT32 iVar;
+    a variable only makes clauses through its false literal, and only
+    breaks clauses through its true literal
+*/
+
+void InitCritSatBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 j,k;
   LITTYPE *pLit;
-  
-  memset(aVarScore,0,(iNumVars+1)*sizeof(int));
-  memset(aCritSat,0,iNumClauses*sizeof(UINT32));
 
-  for (j=0;j<iNumClauses;j++) {
-    if (aNumTrueLit[j]==0) {
+  for (j=iFirst;j<iLast;j++) {
+    aCritSat[j] = 0;
+    if (aNumTrueLit[j]==1) {
+      pLit = pClauseLits[j];
       for (k=0;k<aClauseLen[j];k++) {
-        aVarScore[GetVar(j,k)]--;
-      }
+        if IsLitTrue(*pLit) {
+          aCritSat[j] = GetVarFromLit(*pLit);
+          break;
+        }
+        pLit++;
+      }
+    }
+  }
+}
+
+void InitVarScoreBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 k;
+  UINT32 iVar;
+  SINT32 iScore;
+  LITTYPE litCur;
+  UINT32 *pClause;
+
+  for (iVar=iFirst+1;iVar<=iLast;iVar++) {
+    iScore = 0;
+
+    litCur = GetFalseLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==0) {
+        iScore--;
+      }
+      pClause++;
+    }
+
+    litCur = GetTrueLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==1) {
+        iScore++;
+      }
+      pClause++;
+    }
+
+    aVarScore[iVar] = iScore;
+  }
+}
+
+void CreateVarScore() {
+  aVarScore = AllocateRAM((iNumVars+1)*sizeof(SINT32));
+  aCritSat = AllocateRAM(iNumClauses*sizeof(UINT32));
+}
+
+void InitVarScore() {
+  UINT32 j;
+  UINT32 k;
+  UINT32 iVar;
+  LITTYPE *pLit;
+
+  if (bIncRestartReplayed) {
+    return;
+  }
+
+  if (ParallelBlocks(iNumClauses) > 1) {
+    aVarScore[0] = 0;
+    ParallelFor(iNumClauses,InitCritSatBlock);
+    ParallelFor(iNumVars,InitVarScoreBlock);
+    return;
+  }
+
+  memset(aVarScore,0,(iNumVars+1)*sizeof(SINT32));
+  memset(aCritSat,0,iNumClauses*sizeof(UINT32));
+
+  for (j=0;j<iNumClauses;j++) {
+    if (aNumTrueLit[j]==0) {
+      for (k=0;k<aClauseLen[j];k++) {
+        aVarScore[GetVar(j,k)]--;
+      }
     } else if (aNumTrueLit[j]==1) {
       pLit = pClauseLits[j];
       for (k=0;k<aClauseLen[j];k++) {
@@ -1747,7 +2429,11 @@ void InitVarScoreW() {
   UINT32 k;
   UINT32 iVar;
   LITTYPE *pLit;
-  
+
+  if (bIncRestartReplayed) {
+    return;
+  }
+
   for (j=1;j<=iNumVars;j++) {
     aVarScoreW[j] = FLOATZERO;
   }
@@ -1992,12 +2678,57 @@ void CreateMakeBreak() {
   aCritSat = AllocateRAM(iNumClauses*sizeof(UINT32));
 }
 
+void InitMakeBreakBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 k;
+  UINT32 iVar;
+  UINT32 iCount;
+  LITTYPE litCur;
+  UINT32 *pClause;
+
+  for (iVar=iFirst+1;iVar<=iLast;iVar++) {
+
+    iCount = 0;
+    litCur = GetFalseLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==0) {
+        iCount++;
+      }
+      pClause++;
+    }
+    aMakeCount[iVar] = iCount;
+
+    iCount = 0;
+    litCur = GetTrueLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==1) {
+        iCount++;
+      }
+      pClause++;
+    }
+    aBreakCount[iVar] = iCount;
+  }
+}
+
 void InitMakeBreak() {
   UINT32 j;
   UINT32 k;
   UINT32 iVar;
   LITTYPE *pLit;
-  
+
+  if (bIncRestartReplayed) {
+    return;
+  }
+
+  if (ParallelBlocks(iNumClauses) > 1) {
+    aMakeCount[0] = 0;
+    aBreakCount[0] = 0;
+    ParallelFor(iNumClauses,InitCritSatBlock);
+    ParallelFor(iNumVars,InitMakeBreakBlock);
+    return;
+  }
+
   memset(aMakeCount,0,(iNumVars+1)*sizeof(UINT32));
   memset(aBreakCount,0,(iNumVars+1)*sizeof(UINT32));
   memset(aCritSat,0,iNumClauses*sizeof(UINT32));
@@ -2086,6 +2817,53 @@ void UpdateMakeBreak() {
 }
 
 
+void ParFlipMakeBreak() {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 l;
+  UINT32 iClause;
+  UINT32 *aEvents;
+  LITTYPE *pLit;
+
+  ParFlipEvents(TRUE);
+
+  for (j=0;j<iNumPoolThreads;j++) {
+    aEvents = aParFlipEvents[j];
+    for (k=0;k<aParFlipNumEvents[j];k++) {
+      iClause = GetParFlipClause(aEvents[k]);
+      switch (GetParFlipType(aEvents[k])) {
+        case PARFLIPFALSE:
+          aFalseList[iNumFalse] = iClause;
+          aFalseListPos[iClause] = iNumFalse++;
+          aBreakCount[iFlipCandidate]--;
+          pLit = pClauseLits[iClause];
+          for (l=0;l<aClauseLen[iClause];l++) {
+            aMakeCount[GetVarFromLit(*pLit)]++;
+            pLit++;
+          }
+          break;
+        case PARFLIPCRIT:
+          aBreakCount[aCritSat[iClause]]++;
+          break;
+        case PARFLIPTRUE:
+          aFalseList[aFalseListPos[iClause]] = aFalseList[--iNumFalse];
+          aFalseListPos[aFalseList[iNumFalse]] = aFalseListPos[iClause];
+          pLit = pClauseLits[iClause];
+          for (l=0;l<aClauseLen[iClause];l++) {
+            aMakeCount[GetVarFromLit(*pLit)]--;
+            pLit++;
+          }
+          aBreakCount[iFlipCandidate]++;
+          break;
+        case PARFLIPUNCRIT:
+          aBreakCount[aCritSat[iClause]]--;
+          break;
+      }
+    }
+  }
+}
+
 void FlipMakeBreak() {
 
   UINT32 j;
@@ -2100,6 +2878,11 @@ void FlipMakeBreak() {
     return;
   }
 
+  if (IsParFlip(iFlipCandidate)) {
+    ParFlipMakeBreak();
+    return;
+  }
+
   litWasTrue = GetTrueLit(iFlipCandidate);
   litWasFalse = GetFalseLit(iFlipCandidate);
 
@@ -2172,6 +2955,10 @@ void InitMakeBreakW() {
   UINT32 iVar;
   LITTYPE *pLit;
 
+  if (bIncRestartReplayed) {
+    return;
+  }
+
   for (j=1;j<=iNumVars;j++) {
     aMakeCountW[j] = FLOATZERO;
     aBreakCountW[j] = FLOATZERO;
@@ -2524,8 +3311,194 @@ void FlipVarInFalse() {
   }
 }
 
+void CreateImproveCount() {
+  aImproveScore = AllocateRAM((iNumVars+1)*sizeof(SINT32));
+  aImproveCritSat = AllocateRAM(iNumClauses*sizeof(UINT32));
+  if (bWeighted) {
+    aImproveScoreW = AllocateRAM((iNumVars+1)*sizeof(FLOAT));
+  }
+  bImproveCount = TRUE;
+}
+
+void InitImproveCount() {
+  UINT32 j;
+  UINT32 k;
+  UINT32 iVar;
+  LITTYPE *pLit;
+
+  if (bIncRestartReplayed) {
+    return;
+  }
+
+  memset(aImproveScore,0,(iNumVars+1)*sizeof(SINT32));
+  memset(aImproveCritSat,0,iNumClauses*sizeof(UINT32));
+  if (bWeighted) {
+    for (j=0;j<=iNumVars;j++) {
+      aImproveScoreW[j] = FLOATZERO;
+    }
+  }
+
+  for (j=0;j<iNumClauses;j++) {
+    if (aNumTrueLit[j]==0) {
+      for (k=0;k<aClauseLen[j];k++) {
+        aImproveScore[GetVar(j,k)]--;
+        if (bWeighted) {
+          aImproveScoreW[GetVar(j,k)] -= aClauseWeight[j];
+        }
+      }
+    } else if (aNumTrueLit[j]==1) {
+      pLit = pClauseLits[j];
+      for (k=0;k<aClauseLen[j];k++) {
+        if IsLitTrue(*pLit) {
+          iVar = GetVarFromLit(*pLit);
+          aImproveScore[iVar]++;
+          if (bWeighted) {
+            aImproveScoreW[iVar] += aClauseWeight[j];
+          }
+          aImproveCritSat[j] = iVar;
+          break;
+        }
+        pLit++;
+      }
+    }
+  }
+
+  iNumImproving = 0;
+  iNumImprovingW = 0;
+  iNumImproveZero = 0;
+  iNumImproveZeroW = 0;
+  for (j=1;j<=iNumVars;j++) {
+    if (aImproveScore[j] < 0) {
+      iNumImproving++;
+    } else if (aImproveScore[j] == 0) {
+      iNumImproveZero++;
+    }
+    if (bWeighted) {
+      if (aImproveScoreW[j] < FLOATZERO) {
+        iNumImprovingW++;
+      } else if (aImproveScoreW[j] == FLOATZERO) {
+        iNumImproveZeroW++;
+      }
+    }
+  }
+}
+
+/* the counts only change when a score crosses zero, so the local minimum
+   test costs nothing more than the score updates of the flip */
+
+void AdjustImproveScore(UINT32 iVar, SINT32 iDelta, FLOAT fDelta) {
+
+  SINT32 iOld;
+  FLOAT fOld;
+
+  iOld = aImproveScore[iVar];
+  aImproveScore[iVar] += iDelta;
+  if ((iOld < 0) != (aImproveScore[iVar] < 0)) {
+    if (iOld < 0) {
+      iNumImproving--;
+    } else {
+      iNumImproving++;
+    }
+  }
+  if ((iOld == 0) != (aImproveScore[iVar] == 0)) {
+    if (iOld == 0) {
+      iNumImproveZero--;
+    } else {
+      iNumImproveZero++;
+    }
+  }
+
+  if (bWeighted) {
+    fOld = aImproveScoreW[iVar];
+    aImproveScoreW[iVar] += fDelta;
+    if ((fOld < FLOATZERO) != (aImproveScoreW[iVar] < FLOATZERO)) {
+      if (fOld < FLOATZERO) {
+        iNumImprovingW--;
+      } else {
+        iNumImprovingW++;
+      }
+    }
+    if ((fOld == FLOATZERO) != (aImproveScoreW[iVar] == FLOATZERO)) {
+      if (fOld == FLOATZERO) {
+        iNumImproveZeroW--;
+      } else {
+        iNumImproveZeroW++;
+      }
+    }
+  }
+}
+
+void UpdateImproveCount() {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 *pClause;
+  UINT32 iVar;
+  LITTYPE litWasTrue;
+  LITTYPE litWasFalse;
+  LITTYPE *pLit;
+  FLOAT fWeight = FLOATZERO;
+
+  if (iFlipCandidate == 0) {
+    return;
+  }
+
+  litWasTrue = GetFalseLit(iFlipCandidate);
+  litWasFalse = GetTrueLit(iFlipCandidate);
+
+  pClause = pLitClause[litWasTrue];
+  for (j=0;j<aNumLitOcc[litWasTrue];j++) {
+    if (bWeighted) {
+      fWeight = aClauseWeight[*pClause];
+    }
+    if (aNumTrueLit[*pClause]==0) { 
+      
+      AdjustImproveScore(iFlipCandidate,-1,-fWeight);
+      
+      pLit = pClauseLits[*pClause];
+      for (k=0;k<aClauseLen[*pClause];k++) {
+        AdjustImproveScore(GetVarFromLit(*pLit),-1,-fWeight);
+        pLit++;
+      }
+    }
+    if (aNumTrueLit[*pClause]==1) {
+      pLit = pClauseLits[*pClause];
+      for (k=0;k<aClauseLen[*pClause];k++) {
+        if (IsLitTrue(*pLit)) {
+          iVar = GetVarFromLit(*pLit);
+          AdjustImproveScore(iVar,1,fWeight);
+          aImproveCritSat[*pClause] = iVar;
+          break;
+        }
+        pLit++;
+      }
+    }
+    pClause++;
+  }
+
+  pClause = pLitClause[litWasFalse];
+  for (j=0;j<aNumLitOcc[litWasFalse];j++) {
+    if (bWeighted) {
+      fWeight = aClauseWeight[*pClause];
+    }
+    if (aNumTrueLit[*pClause]==1) {
+      pLit = pClauseLits[*pClause];
+      for (k=0;k<aClauseLen[*pClause];k++) {
+        AdjustImproveScore(GetVarFromLit(*pLit),1,fWeight);
+        pLit++;
+      }
+      AdjustImproveScore(iFlipCandidate,1,fWeight);
+      aImproveCritSat[*pClause] = iFlipCandidate;
+    }
+    if (aNumTrueLit[*pClause]==2) {
+      AdjustImproveScore(aImproveCritSat[*pClause],-1,-fWeight);
+    }
+    pClause++;
+  }
+}
+
 void CreateVarLastChange() {
-  aVarLastChange = AllocateRAM((iNumVars+1)*sizeof(int));
+  aVarLastChange = AllocateRAM((iNumVars+1)*sizeof(UINT32));
 }
 
 void InitVarLastChange() {
@@ -3049,9 +4022,34 @@ void FlipTrackChangesFCLW() {
 }
 
 
+/*
+    variables are only added to (or removed from) the list when their score
+    changes (or they are flipped), so the list is indexed by aDecPromVarsListPos
+    instead of being compacted each step
+*/
+
 void CreateDecPromVars() {
 
   aDecPromVarsList = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aDecPromVarsListPos = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aDecPromVarsSeq = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+}
+
+void AddDecPromVar(UINT32 iVar) {
+  aDecPromVarsSeq[iVar] = ++iDecPromVarsSeq;
+  aDecPromVarsListPos[iVar] = iNumDecPromVars;
+  aDecPromVarsList[iNumDecPromVars++] = iVar;
+}
+
+void RemoveDecPromVar(UINT32 iVar) {
+  UINT32 iLastVar;
+  iLastVar = aDecPromVarsList[--iNumDecPromVars];
+  aDecPromVarsList[aDecPromVarsListPos[iVar]] = iLastVar;
+  aDecPromVarsListPos[iLastVar] = aDecPromVarsListPos[iVar];
+}
+
+BOOL IsDecPromVar(UINT32 iVar) {
+  return((aDecPromVarsListPos[iVar] < iNumDecPromVars) && (aDecPromVarsList[aDecPromVarsListPos[iVar]] == iVar));
 }
 
 void InitDecPromVars() {
@@ -3059,42 +4057,59 @@ void InitDecPromVars() {
   UINT32 j;
 
   iNumDecPromVars = 0;
+  iDecPromVarsSeq = 0;
 
   for (j=1;j<=iNumVars;j++) {
     if (aVarScore[j] < 0) {
-      aDecPromVarsList[iNumDecPromVars++] = j;
+      AddDecPromVar(j);
     }
   }
 }
 
 void UpdateDecPromVars() {
 
-  UINT32 j,k;
+  UINT32 j;
   UINT32 iVar;
 
   for (j=0;j<iNumChanges;j++) {
     iVar = aChangeList[j];
-    if ((aVarScore[iVar] < 0)&&(aChangeOldScore[iVar] >= 0)) {
-      aDecPromVarsList[iNumDecPromVars++] = iVar;
-    }
-  }
-  j=0;
-  k=0;
-  while (j < iNumDecPromVars) {
-    iVar = aDecPromVarsList[k];
-    if ((aVarScore[iVar] >= 0)||(iVar == iFlipCandidate)) {
-      iNumDecPromVars--;
+    if (IsDecPromVar(iVar)) {
+      if (aVarScore[iVar] >= 0) {
+        RemoveDecPromVar(iVar);
+      }
     } else {
-      aDecPromVarsList[j++]=aDecPromVarsList[k];
+      if ((aVarScore[iVar] < 0)&&(aChangeOldScore[iVar] >= 0)&&(iVar != iFlipCandidate)) {
+        AddDecPromVar(iVar);
+      }
     }
-    k++;
+  }
+  if (IsDecPromVar(iFlipCandidate)) {
+    RemoveDecPromVar(iFlipCandidate);
   }
 }
 
 void CreateDecPromVarsW() {
 
   aDecPromVarsListW = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aDecPromVarsListPosW = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  aDecPromVarsSeqW = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+}
+
+void AddDecPromVarW(UINT32 iVar) {
+  aDecPromVarsSeqW[iVar] = ++iDecPromVarsSeqW;
+  aDecPromVarsListPosW[iVar] = iNumDecPromVarsW;
+  aDecPromVarsListW[iNumDecPromVarsW++] = iVar;
+}
+
+void RemoveDecPromVarW(UINT32 iVar) {
+  UINT32 iLastVar;
+  iLastVar = aDecPromVarsListW[--iNumDecPromVarsW];
+  aDecPromVarsListW[aDecPromVarsListPosW[iVar]] = iLastVar;
+  aDecPromVarsListPosW[iLastVar] = aDecPromVarsListPosW[iVar];
+}
 
+BOOL IsDecPromVarW(UINT32 iVar) {
+  return((aDecPromVarsListPosW[iVar] < iNumDecPromVarsW) && (aDecPromVarsListW[aDecPromVarsListPosW[iVar]] == iVar));
 }
 
 void InitDecPromVarsW() {
@@ -3102,35 +4117,272 @@ void InitDecPromVarsW() {
   UINT32 j;
 
   iNumDecPromVarsW = 0;
+  iDecPromVarsSeqW = 0;
 
   for (j=1;j<=iNumVars;j++) {
     if (aVarScoreW[j] < FLOATZERO) {
-      aDecPromVarsListW[iNumDecPromVarsW++] = j;
+      AddDecPromVarW(j);
     }
   }
 }
 
 void UpdateDecPromVarsW() {
 
-  UINT32 j,k;
+  UINT32 j;
   UINT32 iVar;
 
   for (j=0;j<iNumChangesW;j++) {
     iVar = aChangeListW[j];
-    if ((aVarScoreW[iVar] < FLOATZERO)&&(aChangeOldScoreW[iVar] >= 0)) {
-      aDecPromVarsListW[iNumDecPromVarsW++] = iVar;
-    }
-  }
-  j=0;
-  k=0;
-  while (j < iNumDecPromVarsW) {
-    iVar = aDecPromVarsListW[k];
-    if ((aVarScoreW[iVar] >= 0)||(iVar == iFlipCandidate)) {
-      iNumDecPromVarsW--;
+    if (IsDecPromVarW(iVar)) {
+      if (aVarScoreW[iVar] >= FLOATZERO) {
+        RemoveDecPromVarW(iVar);
+      }
     } else {
-      aDecPromVarsListW[j++]=aDecPromVarsListW[k];
+      if ((aVarScoreW[iVar] < FLOATZERO)&&(aChangeOldScoreW[iVar] >= FLOATZERO)&&(iVar != iFlipCandidate)) {
+        AddDecPromVarW(iVar);
+      }
     }
-    k++;
+  }
+  if (IsDecPromVarW(iFlipCandidate)) {
+    RemoveDecPromVarW(iFlipCandidate);
+  }
+}
+
+/*
+    aHeapPos[] is not initialized: a variable is in the heap if its
+    position is valid and the heap entry at that position is the variable
+*/
+
+void CreateVarHeap(VARHEAP *pHeap) {
+  pHeap->aHeap = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  pHeap->aHeapPos = AllocateRAM((iNumVars+1) * sizeof(UINT32));
+  pHeap->iNum = 0;
+}
+
+BOOL IsInVarHeap(VARHEAP *pHeap, UINT32 iVar) {
+  return((pHeap->aHeapPos[iVar] < pHeap->iNum) && (pHeap->aHeap[pHeap->aHeapPos[iVar]] == iVar));
+}
+
+void SiftUpVarHeap(VARHEAP *pHeap, UINT32 iPos) {
+  UINT32 iVar;
+  UINT32 iParent;
+
+  iVar = pHeap->aHeap[iPos];
+  while (iPos > 0) {
+    iParent = (iPos - 1) >> 1;
+    if (!pHeap->fxnBefore(iVar,pHeap->aHeap[iParent])) {
+      break;
+    }
+    pHeap->aHeap[iPos] = pHeap->aHeap[iParent];
+    pHeap->aHeapPos[pHeap->aHeap[iPos]] = iPos;
+    iPos = iParent;
+  }
+  pHeap->aHeap[iPos] = iVar;
+  pHeap->aHeapPos[iVar] = iPos;
+}
+
+void SiftDownVarHeap(VARHEAP *pHeap, UINT32 iPos) {
+  UINT32 iVar;
+  UINT32 iChild;
+
+  iVar = pHeap->aHeap[iPos];
+  while ((iChild = (iPos << 1) + 1) < pHeap->iNum) {
+    if ((iChild + 1 < pHeap->iNum) && (pHeap->fxnBefore(pHeap->aHeap[iChild+1],pHeap->aHeap[iChild]))) {
+      iChild++;
+    }
+    if (!pHeap->fxnBefore(pHeap->aHeap[iChild],iVar)) {
+      break;
+    }
+    pHeap->aHeap[iPos] = pHeap->aHeap[iChild];
+    pHeap->aHeapPos[pHeap->aHeap[iPos]] = iPos;
+    iPos = iChild;
+  }
+  pHeap->aHeap[iPos] = iVar;
+  pHeap->aHeapPos[iVar] = iPos;
+}
+
+void InsertVarHeap(VARHEAP *pHeap, UINT32 iVar) {
+  pHeap->aHeap[pHeap->iNum] = iVar;
+  pHeap->aHeapPos[iVar] = pHeap->iNum;
+  pHeap->iNum++;
+  SiftUpVarHeap(pHeap,pHeap->iNum - 1);
+}
+
+void RemoveVarHeap(VARHEAP *pHeap, UINT32 iVar) {
+  UINT32 iPos;
+
+  iPos = pHeap->aHeapPos[iVar];
+  pHeap->iNum--;
+  if (iPos < pHeap->iNum) {
+    pHeap->aHeap[iPos] = pHeap->aHeap[pHeap->iNum];
+    pHeap->aHeapPos[pHeap->aHeap[iPos]] = iPos;
+    AdjustVarHeap(pHeap,pHeap->aHeap[iPos]);
+  }
+}
+
+void AdjustVarHeap(VARHEAP *pHeap, UINT32 iVar) {
+  UINT32 iPos;
+
+  iPos = pHeap->aHeapPos[iVar];
+  SiftUpVarHeap(pHeap,iPos);
+  if (pHeap->aHeapPos[iVar] == iPos) {
+    SiftDownVarHeap(pHeap,iPos);
+  }
+}
+
+/* 
+    synchronize a heap with the decreasing promising variables:
+    only the variables with a score change this step (and the flipped
+    variable) can have been added to or removed from the list
+
+    the heap is only valid if the key of (at most) one variable in the heap
+    has changed since it was last positioned, so the flipped variable (the
+    only variable with a new aVarLastChange) is removed first, and the
+    scores used by hDecPromBest are copied into aDecPromBestScore one
+    variable at a time
+*/
+
+void UpdateDecPromHeapVar(VARHEAP *pHeap, UINT32 iVar, BOOL bAdjust) {
+  if (IsDecPromVar(iVar)) {
+    if (IsInVarHeap(pHeap,iVar)) {
+      if (bAdjust) {
+        AdjustVarHeap(pHeap,iVar);
+      }
+    } else {
+      InsertVarHeap(pHeap,iVar);
+    }
+  } else {
+    if (IsInVarHeap(pHeap,iVar)) {
+      RemoveVarHeap(pHeap,iVar);
+    }
+  }
+}
+
+void InitDecPromHeap(VARHEAP *pHeap, UINT32 *aList, UINT32 iNum) {
+  UINT32 j;
+
+  pHeap->iNum = 0;
+  for (j=0;j<iNum;j++) {
+    InsertVarHeap(pHeap,aList[j]);
+  }
+}
+
+BOOL IsDecPromBetter(UINT32 iVarA, UINT32 iVarB) {
+  if (aDecPromBestScore[iVarA] != aDecPromBestScore[iVarB]) {
+    return(aDecPromBestScore[iVarA] < aDecPromBestScore[iVarB]);
+  }
+  if (aVarLastChange[iVarA] != aVarLastChange[iVarB]) {
+    return(aVarLastChange[iVarA] < aVarLastChange[iVarB]);
+  }
+  return(aDecPromVarsSeq[iVarA] < aDecPromVarsSeq[iVarB]);
+}
+
+BOOL IsDecPromBetterW(UINT32 iVarA, UINT32 iVarB) {
+  if (aDecPromBestScoreW[iVarA] != aDecPromBestScoreW[iVarB]) {
+    return(aDecPromBestScoreW[iVarA] < aDecPromBestScoreW[iVarB]);
+  }
+  if (aVarLastChange[iVarA] != aVarLastChange[iVarB]) {
+    return(aVarLastChange[iVarA] < aVarLastChange[iVarB]);
+  }
+  return(aDecPromVarsSeqW[iVarA] < aDecPromVarsSeqW[iVarB]);
+}
+
+BOOL IsDecPromOlder(UINT32 iVarA, UINT32 iVarB) {
+  if (aVarLastChange[iVarA] != aVarLastChange[iVarB]) {
+    return(aVarLastChange[iVarA] < aVarLastChange[iVarB]);
+  }
+  return(aDecPromVarsSeq[iVarA] < aDecPromVarsSeq[iVarB]);
+}
+
+void CreateDecPromBest() {
+  CreateVarHeap(&hDecPromBest);
+  hDecPromBest.fxnBefore = IsDecPromBetter;
+  aDecPromBestScore = AllocateRAM((iNumVars+1) * sizeof(SINT32));
+}
+
+void InitDecPromBest() {
+  memcpy(aDecPromBestScore,aVarScore,(iNumVars+1) * sizeof(SINT32));
+  InitDecPromHeap(&hDecPromBest,aDecPromVarsList,iNumDecPromVars);
+}
+
+void UpdateDecPromBest() {
+  UINT32 j;
+  UINT32 iVar;
+
+  if (IsInVarHeap(&hDecPromBest,iFlipCandidate)) {
+    RemoveVarHeap(&hDecPromBest,iFlipCandidate);
+  }
+  aDecPromBestScore[iFlipCandidate] = aVarScore[iFlipCandidate];
+
+  for (j=0;j<iNumChanges;j++) {
+    iVar = aChangeList[j];
+    if (aDecPromBestScore[iVar] != aVarScore[iVar]) {
+      aDecPromBestScore[iVar] = aVarScore[iVar];
+      UpdateDecPromHeapVar(&hDecPromBest,iVar,TRUE);
+    } else {
+      UpdateDecPromHeapVar(&hDecPromBest,iVar,FALSE);
+    }
+  }
+}
+
+void CreateDecPromBestW() {
+  CreateVarHeap(&hDecPromBestW);
+  hDecPromBestW.fxnBefore = IsDecPromBetterW;
+  aDecPromBestScoreW = AllocateRAM((iNumVars+1) * sizeof(FLOAT));
+}
+
+void InitDecPromBestW() {
+  memcpy(aDecPromBestScoreW,aVarScoreW,(iNumVars+1) * sizeof(FLOAT));
+  InitDecPromHeap(&hDecPromBestW,aDecPromVarsListW,iNumDecPromVarsW);
+}
+
+void UpdateDecPromBestW() {
+  UINT32 j;
+  UINT32 iVar;
+
+  /* most of the changed variables are not (and do not become) decreasing
+     promising variables, so the saved score is only kept for the heap */
+
+  if (IsInVarHeap(&hDecPromBestW,iFlipCandidate)) {
+    RemoveVarHeap(&hDecPromBestW,iFlipCandidate);
+  }
+
+  for (j=0;j<iNumChangesW;j++) {
+    iVar = aChangeListW[j];
+    if (IsInVarHeap(&hDecPromBestW,iVar)) {
+      if (!IsDecPromVarW(iVar)) {
+        RemoveVarHeap(&hDecPromBestW,iVar);
+      } else if (aDecPromBestScoreW[iVar] != aVarScoreW[iVar]) {
+        aDecPromBestScoreW[iVar] = aVarScoreW[iVar];
+        AdjustVarHeap(&hDecPromBestW,iVar);
+      }
+    } else if (IsDecPromVarW(iVar)) {
+      aDecPromBestScoreW[iVar] = aVarScoreW[iVar];
+      InsertVarHeap(&hDecPromBestW,iVar);
+    }
+  }
+}
+
+void CreateDecPromOldest() {
+  CreateVarHeap(&hDecPromOldest);
+  hDecPromOldest.fxnBefore = IsDecPromOlder;
+}
+
+void InitDecPromOldest() {
+  InitDecPromHeap(&hDecPromOldest,aDecPromVarsList,iNumDecPromVars);
+}
+
+void UpdateDecPromOldest() {
+  UINT32 j;
+
+  /* the age of a variable can't change while it is a decreasing promising variable */
+
+  if (IsInVarHeap(&hDecPromOldest,iFlipCandidate)) {
+    RemoveVarHeap(&hDecPromOldest,iFlipCandidate);
+  }
+
+  for (j=0;j<iNumChanges;j++) {
+    UpdateDecPromHeapVar(&hDecPromOldest,aChangeList[j],FALSE);
   }
 }
 
@@ -3222,7 +4474,8 @@ void InitClausePenaltyFL() {
 
   fBasePenaltyFL = 1.0f;
   fTotalPenaltyFL = (FLOAT) iNumClauses;
- 
+
+  PenaltyStatsChangeAll();
 }
 
 void InitClausePenaltyFLW() {
@@ -3237,6 +4490,7 @@ void InitClausePenaltyFLW() {
 
   fBasePenaltyFL = 1.0f;
 
+  PenaltyStatsChangeAll();
 }
 
 
@@ -3246,6 +4500,39 @@ void CreateMakeBreakPenaltyFL() {
   aCritSat = AllocateRAM(iNumClauses*sizeof(UINT32));
 }
 
+void InitMakeBreakPenaltyFLBlock(UINT32 iThread, UINT32 iFirst, UINT32 iLast) {
+  UINT32 k;
+  UINT32 iVar;
+  FLOAT fSum;
+  LITTYPE litCur;
+  UINT32 *pClause;
+
+  for (iVar=iFirst+1;iVar<=iLast;iVar++) {
+
+    fSum = FLOATZERO;
+    litCur = GetFalseLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==0) {
+        fSum += aClausePenaltyFL[*pClause];
+      }
+      pClause++;
+    }
+    aMakePenaltyFL[iVar] = fSum;
+
+    fSum = FLOATZERO;
+    litCur = GetTrueLit(iVar);
+    pClause = pLitClause[litCur];
+    for (k=0;k<aNumLitOcc[litCur];k++) {
+      if (aNumTrueLit[*pClause]==1) {
+        fSum += aClausePenaltyFL[*pClause];
+      }
+      pClause++;
+    }
+    aBreakPenaltyFL[iVar] = fSum;
+  }
+}
+
 void InitMakeBreakPenaltyFL() {
 
   UINT32 j;
@@ -3253,6 +4540,12 @@ void InitMakeBreakPenaltyFL() {
   UINT32 iVar;
   LITTYPE *pLit;
 
+  if (ParallelBlocks(iNumClauses) > 1) {
+    ParallelFor(iNumClauses,InitCritSatBlock);
+    ParallelFor(iNumVars,InitMakeBreakPenaltyFLBlock);
+    return;
+  }
+
   for (j=1;j<=iNumVars;j++) {
     aMakePenaltyFL[j] = FLOATZERO;
     aBreakPenaltyFL[j] = FLOATZERO;
@@ -3349,6 +4642,72 @@ void UpdateMakeBreakPenaltyFL() {
 }
 
 
+void ParFlipMBPFLandFCLandVIF() {
+
+  UINT32 j;
+  UINT32 k;
+  UINT32 l;
+  UINT32 iVar;
+  UINT32 iClause;
+  UINT32 *aEvents;
+  LITTYPE *pLit;
+  FLOAT fPenalty;
+
+  ParFlipEvents(TRUE);
+
+  for (j=0;j<iNumPoolThreads;j++) {
+    aEvents = aParFlipEvents[j];
+    for (k=0;k<aParFlipNumEvents[j];k++) {
+      iClause = GetParFlipClause(aEvents[k]);
+      fPenalty = aClausePenaltyFL[iClause];
+      switch (GetParFlipType(aEvents[k])) {
+        case PARFLIPFALSE:
+          aFalseList[iNumFalse] = iClause;
+          aFalseListPos[iClause] = iNumFalse++;
+          aBreakCount[iFlipCandidate]--;
+          aBreakPenaltyFL[iFlipCandidate] -= fPenalty;
+          pLit = pClauseLits[iClause];
+          for (l=0;l<aClauseLen[iClause];l++) {
+            iVar = GetVarFromLit(*pLit);
+            aMakeCount[iVar]++;
+            aMakePenaltyFL[iVar] += fPenalty;
+            if (aMakeCount[iVar]==1) {
+              aVarInFalseList[iNumVarsInFalseList] = iVar;
+              aVarInFalseListPos[iVar] = iNumVarsInFalseList++;
+            }
+            pLit++;
+          }
+          break;
+        case PARFLIPCRIT:
+          aBreakCount[aCritSat[iClause]]++;
+          aBreakPenaltyFL[aCritSat[iClause]] += fPenalty;
+          break;
+        case PARFLIPTRUE:
+          aFalseList[aFalseListPos[iClause]] = aFalseList[--iNumFalse];
+          aFalseListPos[aFalseList[iNumFalse]] = aFalseListPos[iClause];
+          pLit = pClauseLits[iClause];
+          for (l=0;l<aClauseLen[iClause];l++) {
+            iVar = GetVarFromLit(*pLit);
+            aMakeCount[iVar]--;
+            aMakePenaltyFL[iVar] -= fPenalty;
+            if (aMakeCount[iVar]==0) {
+              aVarInFalseList[aVarInFalseListPos[iVar]] = aVarInFalseList[--iNumVarsInFalseList];
+              aVarInFalseListPos[aVarInFalseList[iNumVarsInFalseList]] = aVarInFalseListPos[iVar];
+            }
+            pLit++;
+          }
+          aBreakCount[iFlipCandidate]++;
+          aBreakPenaltyFL[iFlipCandidate] += fPenalty;
+          break;
+        case PARFLIPUNCRIT:
+          aBreakCount[aCritSat[iClause]]--;
+          aBreakPenaltyFL[aCritSat[iClause]] -= fPenalty;
+          break;
+      }
+    }
+  }
+}
+
 void FlipMBPFLandFCLandVIF() {
 
   UINT32 j;
@@ -3365,6 +4724,11 @@ void FlipMBPFLandFCLandVIF() {
     return;
   }
 
+  if (IsParFlip(iFlipCandidate)) {
+    ParFlipMBPFLandFCLandVIF();
+    return;
+  }
+
   litWasTrue = GetTrueLit(iFlipCandidate);
   litWasFalse = GetFalseLit(iFlipCandidate);
 
@@ -3568,7 +4932,8 @@ void InitClausePenaltyINT() {
   }
   iBasePenaltyINT = iInitPenaltyINT;
   iTotalPenaltyINT = iNumClauses * iInitPenaltyINT;
- 
+
+  PenaltyStatsChangeAll();
 }
 
 void InitClausePenaltyINTW() {
@@ -3585,6 +4950,7 @@ void InitClausePenaltyINTW() {
 
   iBasePenaltyINT = 1;
 
+  PenaltyStatsChangeAll();
 }
 
 
@@ -3966,6 +5332,62 @@ void UpdateBestFalse() {
 
 void CreateSaveBest() {
   vsBest = NewVarState();
+
+  iBestJournalMax = iNumVars;
+  if (iBestJournalMax == 0) {
+    iBestJournalMax = 1;
+  }
+  aBestJournal = AllocateRAM(iBestJournalMax*sizeof(UINT32));
+  iNumBestJournal = 0;
+  iBestJournalLen = 0;
+  bBestJournalValid = FALSE;
+}
+
+void MaterializeSaveBest() {
+  UINT32 j;
+
+  /* vsBest is brought up to date by toggling the variables flipped
+     before the best step, and those flips are removed from the journal */
+
+  if (iBestJournalLen == 0) {
+    return;
+  }
+
+  for (j=0;j<iBestJournalLen;j++) {
+    ToggleVarStateBit(vsBest,aBestJournal[j]-1);
+  }
+
+  iNumBestJournal -= iBestJournalLen;
+  memmove(aBestJournal,&aBestJournal[iBestJournalLen],iNumBestJournal*sizeof(UINT32));
+  iBestJournalLen = 0;
+}
+
+void InitSaveBest() {
+
+  /* the assignment can change wholesale when the state information is
+     (re-)initialized, so the next best must be a full copy */
+
+  MaterializeSaveBest();
+  iNumBestJournal = 0;
+  bBestJournalValid = FALSE;
+}
+
+void JournalSaveBest() {
+  if ((iFlipCandidate == 0) || (!bBestJournalValid)) {
+    return;
+  }
+  if (iNumBestJournal == iBestJournalMax) {
+    MaterializeSaveBest();
+    if (iNumBestJournal == iBestJournalMax) {
+
+      /* too many flips since the best: a full copy is cheaper */
+
+      iNumBestJournal = 0;
+      bBestJournalValid = FALSE;
+      return;
+    }
+  }
+  aBestJournal[iNumBestJournal++] = iFlipCandidate;
 }
 
 void UpdateSaveBest() {
@@ -3981,7 +5403,14 @@ void UpdateSaveBest() {
     }
   }
   if (bSave) {
-    SetCurVarState(vsBest);
+    if (bBestJournalValid) {
+      iBestJournalLen = iNumBestJournal;
+    } else {
+      SetCurVarState(vsBest);
+      iNumBestJournal = 0;
+      iBestJournalLen = 0;
+      bBestJournalValid = TRUE;
+    }
   }
 }
 
@@ -4124,6 +5553,9 @@ void CheckNoImprove() {
 }
 
 void StartSeed () {
+  if ((bFarmWorker) || (bFarmCoordinator)) {
+    return;
+  }
   if (iRun==1) {
     iStartSeed = iSeed;
   } else {
@@ -4175,72 +5607,545 @@ void CheckForRestarts() {
   }
 }      
 
-void CreateFlipCounts() {
-  aFlipCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
-}
+/*
+    The restart policies (-restartpolicy) are a layer on top of the restart
+    mechanism that any algorithm can use: each policy is a trigger
+    (RestartLuby, RestartGeometric, ...) that is activated by
+    SetupRestartPolicy, and that sets iRestartLength, the # of steps until
+    the next restart, at each restart (PreInit).  A length of 0 means that
+    there is no restart until the end of the run.
+
+    To add a policy, create its triggers and add it to aRestartPolicies.
+*/
 
-void InitFlipCounts() {
-  if (iStep == 1) {
-    memset(aFlipCounts,0,(iNumVars+1)*sizeof(UINT32));
-  }
-}
+const char *aRestartPolicies[][2] = {
+  {"luby","RestartLuby"},
+  {"geometric","RestartGeometric"},
+  {"adaptive","RestartAdaptive"},
+};
 
-void UpdateFlipCounts() {
-  aFlipCounts[iFlipCandidate]++;
-}
+#define NUMRESTARTPOLICIES (sizeof(aRestartPolicies) / sizeof(aRestartPolicies[0]))
 
-void FlipCountStats() {
+void SetupRestartPolicy() {
   UINT32 j;
-  FLOAT fSum = FLOATZERO;
-  FLOAT fSum2 = FLOATZERO;
-  
-  for (j=1;j<(iNumVars+1);j++) {
-    fSum += (FLOAT) aFlipCounts[j];
-    fSum2 += (FLOAT) (aFlipCounts[j] * aFlipCounts[j]);
+
+  for (j=0;j<NUMRESTARTPOLICIES;j++) {
+    if (strcmp(sRestartPolicy,aRestartPolicies[j][0])==0) {
+      ActivateTriggers((char *) aRestartPolicies[j][1]);
+      break;
+    }
+  }
+  if (j == NUMRESTARTPOLICIES) {
+    ReportPrint1(pRepErr,"Error: unknown -restartpolicy [%s] (choose from:",sRestartPolicy);
+    for (j=0;j<NUMRESTARTPOLICIES;j++) {
+      ReportPrint1(pRepErr," %s",aRestartPolicies[j][0]);
+    }
+    ReportPrint(pRepErr,")\n");
+    AbnormalExit();
+  }
+  if (fRestartFactor < 1.0) {
+    ReportPrint1(pRepErr,"Error: -restartfactor must be >= 1 (not %.6g)\n",fRestartFactor);
+    AbnormalExit();
   }
+}
 
-  CalculateStats(&fFlipCountsMean,&fFlipCountsStdDev,&fFlipCountsCV,fSum,fSum2,iNumVars);
+void InitRestartPolicy() {
+  if (iRestartBase) {
+    iRestartUnit = iRestartBase;
+  } else {
+    iRestartUnit = iNumVars;
+  }
+  iRestartNum = 0;
+  iRestartLength = 0;
+  iRestartLast = 0;
+  iRestartTry = 0;
 }
 
-void CreateBiasCounts() {
-  aBiasTrueCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
-  aBiasFalseCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+void StartRestartPolicy() {
+
+  /* the # of flips of the try that is ended by this restart */
+
+  if (iRestartNum) {
+    iRestartTry = iStep - iRestartLast - 1;
+  }
+  iRestartNum++;
+  iRestartLast = iStep;
 }
 
-void PreInitBiasCounts() {
-  UINT32 j;
-  if (iStep == 1) {
-    memset(aBiasTrueCounts,0,(iNumVars+1)*sizeof(UINT32));
-    memset(aBiasFalseCounts,0,(iNumVars+1)*sizeof(UINT32));
-  } else {
-    for (j=1;j<=iNumVars;j++) {
-      if (aVarValue[j]) {
-        aBiasTrueCounts[j] += (iStep-1-(aVarLastChange[j]));
-      } else {
-        aBiasFalseCounts[j] += (iStep-1-(aVarLastChange[j]));
-      }
-    }
+void CheckRestartPolicy() {
+  if ((iRestartLength) && (iStep - iRestartLast > iRestartLength)) {
+    bRestart = TRUE;
   }
 }
 
-void UpdateBiasCounts() {
-  if (iFlipCandidate) {
-    if (aVarValue[iFlipCandidate]) {
-      aBiasTrueCounts[iFlipCandidate] += (iStep-(aVarLastChange[iFlipCandidate]));
-    } else {
-      aBiasFalseCounts[iFlipCandidate] += (iStep-(aVarLastChange[iFlipCandidate]));
-    }
+UINT32 RestartLength(FLOAT fLength) {
+  if (fLength >= (FLOAT) UINT32MAX) {
+    return(UINT32MAX);
+  }
+  if (fLength < 1.0) {
+    return(1);
   }
+  return((UINT32) fLength);
 }
 
-void FinalBiasCounts() {
-  UINT32 j;
-  for (j=1;j<=iNumVars;j++) {
-    if (aVarValue[j]) {
-      aBiasTrueCounts[j] += (iStep-(aVarLastChange[j]));
-    } else {
-      aBiasFalseCounts[j] += (iStep-(aVarLastChange[j]));
-    }
+/*
+    The Luby sequence (1,1,2,1,1,2,4,1,1,2,...) of restart lengths, in units of
+    -restartbase steps, is within a log factor of the optimal restart
+    strategy for any (unknown) run-length distribution
+*/
+
+UINT32 LubyTerm(UINT32 iTerm) {
+  UINT32 iSize;
+  UINT32 iPower;
+
+  /* find the finite subsequence that contains iTerm (counting from 0) */
+
+  iSize = 1;
+  iPower = 0;
+  while (iSize < iTerm + 1) {
+    iPower++;
+    iSize = 2 * iSize + 1;
+  }
+  while (iSize - 1 != iTerm) {
+    iSize = (iSize - 1) >> 1;
+    iPower--;
+    iTerm = iTerm % iSize;
+  }
+  return(iPower);
+}
+
+void NextRestartLuby() {
+  iRestartLength = RestartLength((FLOAT) iRestartUnit * pow(2.0,(FLOAT) LubyTerm(iRestartNum - 1)));
+}
+
+void InitRestartGeometric() {
+  fRestartGeometricLength = (FLOAT) iRestartUnit;
+}
+
+void NextRestartGeometric() {
+  iRestartLength = RestartLength(fRestartGeometricLength);
+  fRestartGeometricLength *= fRestartFactor;
+}
+
+/*
+    The adaptive policy fits a (shifted) Weibull distribution to the lengths
+    of the tries (the steps between restarts) of the previous runs: a try
+    that ends with a restart (or at the cutoff) is censored.  When the
+    shape is < 1 (heavier tail than an exponential), the restart length that
+    minimizes the expected # of steps to a solution is used, otherwise the
+    runs are not restarted.  Until enough tries were successful, the Luby
+    sequence is used.
+
+    The fit is only repeated once the # of tries has grown by 1/8 since the
+    last fit (so its cost is amortized over the tries), and the logs of the
+    try lengths are calculated once per fit, not in every iteration.
+*/
+
+void CreateRestartAdaptive() {
+  aRestartAdaptLength = AllocateRAM(RESTARTADAPTMAXTRIES * sizeof(UINT32));
+  aRestartAdaptFound = AllocateRAM(RESTARTADAPTMAXTRIES * sizeof(BOOL));
+  aRestartAdaptLogLen = AllocateRAM(RESTARTADAPTMAXTRIES * sizeof(FLOAT));
+  iNumRestartAdapt = 0;
+  iNextRestartAdapt = 0;
+  iNumRestartAdaptFound = 0;
+  iRestartAdaptAdded = 0;
+  iRestartAdaptNextFit = 0;
+  bRestartAdaptFitted = FALSE;
+}
+
+void AddRestartAdaptTry(UINT32 iLength, BOOL bFound) {
+
+  /* when full, the oldest tries are replaced */
+
+  if ((iNumRestartAdapt == RESTARTADAPTMAXTRIES) && (aRestartAdaptFound[iNextRestartAdapt])) {
+    iNumRestartAdaptFound--;
+  }
+  if (bFound) {
+    iNumRestartAdaptFound++;
+  }
+  iRestartAdaptAdded++;
+
+  aRestartAdaptLength[iNextRestartAdapt] = iLength;
+  aRestartAdaptFound[iNextRestartAdapt] = bFound;
+  iNextRestartAdapt++;
+  if (iNextRestartAdapt == RESTARTADAPTMAXTRIES) {
+    iNextRestartAdapt = 0;
+  }
+  if (iNumRestartAdapt < RESTARTADAPTMAXTRIES) {
+    iNumRestartAdapt++;
+  }
+}
+
+BOOL FitRestartAdaptive() {
+  UINT32 j;
+  UINT32 iIter;
+  UINT32 iNumFound;
+  UINT32 iMinFound;
+  FLOAT fMaxLen;
+  FLOAT fLogMaxLen;
+  FLOAT fLen;
+  FLOAT fMeanLogFound;
+  FLOAT fLow;
+  FLOAT fHigh;
+  FLOAT fShape;
+  FLOAT fSum;
+  FLOAT fSumLog;
+  FLOAT fPow;
+
+  if (iNumRestartAdaptFound < RESTARTADAPTMINFOUND) {
+    return(FALSE);
+  }
+
+  iNumFound = 0;
+  iMinFound = UINT32MAX;
+  for (j=0;j<iNumRestartAdapt;j++) {
+    if (aRestartAdaptFound[j]) {
+      iNumFound++;
+      if (aRestartAdaptLength[j] < iMinFound) {
+        iMinFound = aRestartAdaptLength[j];
+      }
+    }
+  }
+  if (iNumFound < RESTARTADAPTMINFOUND) {
+    return(FALSE);
+  }
+
+  /* the shift is the shortest successful try (the Weibull part starts at 1) */
+
+  fRestartAdaptShift = (FLOAT) iMinFound - 1.0;
+
+  /* (a try that is shorter than the shift has a log length of -1, and is not used) */
+
+  fMaxLen = FLOATZERO;
+  fMeanLogFound = FLOATZERO;
+  for (j=0;j<iNumRestartAdapt;j++) {
+    fLen = (FLOAT) aRestartAdaptLength[j] - fRestartAdaptShift;
+    if (fLen >= 1.0) {
+      aRestartAdaptLogLen[j] = log(fLen);
+      if (fLen > fMaxLen) {
+        fMaxLen = fLen;
+      }
+      if (aRestartAdaptFound[j]) {
+        fMeanLogFound += aRestartAdaptLogLen[j];
+      }
+    } else {
+      aRestartAdaptLogLen[j] = -1.0;
+    }
+  }
+  fMeanLogFound /= (FLOAT) iNumFound;
+  fLogMaxLen = log(fMaxLen);
+
+  /* maximum likelihood shape: the root of an increasing function (in log(shape)),
+     with the lengths scaled by the maximum to avoid overflow */
+
+  fLow = log(RESTARTADAPTMINSHAPE);
+  fHigh = log(RESTARTADAPTMAXSHAPE);
+  fShape = 1.0;
+  for (iIter=0;iIter<RESTARTADAPTITERATIONS;iIter++) {
+    fShape = exp((fLow + fHigh) / 2.0);
+    fSum = FLOATZERO;
+    fSumLog = FLOATZERO;
+    for (j=0;j<iNumRestartAdapt;j++) {
+      if (aRestartAdaptLogLen[j] >= FLOATZERO) {
+        fPow = exp(fShape * (aRestartAdaptLogLen[j] - fLogMaxLen));
+        fSum += fPow;
+        fSumLog += fPow * aRestartAdaptLogLen[j];
+      }
+    }
+    if (fSumLog / fSum - 1.0 / fShape - fMeanLogFound > FLOATZERO) {
+      fHigh = log(fShape);
+    } else {
+      fLow = log(fShape);
+    }
+  }
+
+  fRestartAdaptShape = fShape;
+  fRestartAdaptScale = fMaxLen * pow(fSum / (FLOAT) iNumFound,1.0 / fShape);
+
+  return(TRUE);
+}
+
+UINT32 OptimalRestartAdaptive() {
+  UINT32 j;
+  FLOAT fLen;
+  FLOAT fMaxLen;
+  FLOAT fPrevLen;
+  FLOAT fSurvival;
+  FLOAT fPrevSurvival;
+  FLOAT fArea;
+  FLOAT fExpected;
+  FLOAT fBestExpected;
+  FLOAT fBestLen;
+
+  /* a heavy tail is required for restarts to help */
+
+  if (fRestartAdaptShape >= 1.0) {
+    return(0);
+  }
+
+  /* the expected # of steps with restarts at (shift + x) is
+     (shift + integral of the survival function to x) / P(success by x),
+     which is searched over a geometric grid of x */
+
+  fBestExpected = fRestartAdaptShift + fRestartAdaptScale * exp(lgamma(1.0 + 1.0 / fRestartAdaptShape));
+  fBestLen = FLOATZERO;
+
+  fMaxLen = fRestartAdaptScale * pow(RESTARTADAPTMAXTAIL,1.0 / fRestartAdaptShape);
+  if (fMaxLen < 1.0) {
+    return(0);
+  }
+
+  fPrevLen = FLOATZERO;
+  fPrevSurvival = 1.0;
+  fArea = FLOATZERO;
+  for (j=0;j<=RESTARTADAPTGRID;j++) {
+    fLen = pow(fMaxLen,(FLOAT) j / (FLOAT) RESTARTADAPTGRID);
+    fSurvival = exp(-pow(fLen / fRestartAdaptScale,fRestartAdaptShape));
+    fArea += (fLen - fPrevLen) * (fSurvival + fPrevSurvival) / 2.0;
+    if (fSurvival < 1.0) {
+      fExpected = (fRestartAdaptShift + fArea) / (1.0 - fSurvival);
+      if (fExpected < fBestExpected) {
+        fBestExpected = fExpected;
+        fBestLen = fLen;
+      }
+    }
+    fPrevLen = fLen;
+    fPrevSurvival = fSurvival;
+  }
+
+  if (fBestLen == FLOATZERO) {
+    return(0);
+  }
+  return(RestartLength(fRestartAdaptShift + fBestLen));
+}
+
+void InitRestartAdaptive() {
+
+  /* the previous fit is kept until there are enough new tries */
+
+  if (iRestartAdaptAdded < iRestartAdaptNextFit) {
+    return;
+  }
+  if (FitRestartAdaptive()) {
+    bRestartAdaptFitted = TRUE;
+    iRestartAdaptCutoff = OptimalRestartAdaptive();
+    iRestartAdaptNextFit = iRestartAdaptAdded + 1 + iRestartAdaptAdded / RESTARTADAPTREFITFRAC;
+  }
+}
+
+void NextRestartAdaptive() {
+
+  /* the try that is ended by this restart was unsuccessful */
+
+  if (iRestartNum > 1) {
+    AddRestartAdaptTry(iRestartTry,FALSE);
+  }
+
+  if (bRestartAdaptFitted) {
+    iRestartLength = iRestartAdaptCutoff;
+  } else {
+    iRestartLength = RestartLength((FLOAT) iRestartUnit * pow(2.0,(FLOAT) LubyTerm(iRestartNum - 1)));
+  }
+}
+
+void UpdateRestartAdaptive() {
+  AddRestartAdaptTry(iStep - iRestartLast,bSolutionFound);
+}
+
+/*
+    With -increstart, the assignment before a restart is saved (PreInit),
+    and after the new assignment is made (InitData) the variables that
+    changed are flipped back one at a time from the old assignment, so that
+    the state information maintained by the flip procedures is updated
+    incrementally.  The Init procedures of that state information then
+    return immediately; all other Init procedures (penalties, tabu, etc.)
+    still run, so a restart has the same effect as before.  The false
+    clause list and the VarInFalse list are the exception: the flips would
+    leave them in a different order (and so change the search), and they
+    are rebuilt by a single scan of aNumTrueLit / aMakeCount.
+
+    Each Init procedure visits every literal, whereas a replayed flip visits
+    the clauses of the variable in each flip procedure, and some of them
+    again through their literals.  Replaying a new random assignment (half
+    of the variables change) was measured at twice the cost of a full
+    re-initialization, so the flips are only used when they touch fewer
+    than iNumLits / 4 clauses.  A random restart is never below that, but
+    restarts close to the old assignment (e.g. -varinitgreedy) are.
+
+    ReplayIncRestart must run before the other InitStateInfo procedures,
+    which is the case as it is activated by the -increstart parameter.
+*/
+
+void CreateIncRestart() {
+  aIncRestartPrev = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  aIncRestartDiff = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  bIncRestartValid = FALSE;
+}
+
+void SaveIncRestart() {
+
+  /* the state information is only valid after the first initialization */
+
+  if (bIncRestartValid) {
+    memcpy(aIncRestartPrev,aVarValue,(iNumVars+1)*sizeof(UINT32));
+    bIncRestartArmed = TRUE;
+  }
+}
+
+void ReplayIncRestart() {
+  UINT32 j;
+  UINT32 k;
+  UINT32 iNumDiff;
+  UINT32 iClauseVisits;
+  UINT32 iSaveFlipCandidate;
+  FXNPTR pProc;
+
+  if (!bIncRestartArmed) {
+    return;
+  }
+  bIncRestartArmed = FALSE;
+
+  iNumDiff = 0;
+  iClauseVisits = 0;
+
+  for (j=1;j<=iNumVars;j++) {
+    if (aVarValue[j] != aIncRestartPrev[j]) {
+      aIncRestartDiff[iNumDiff++] = j;
+      iClauseVisits += aNumLitOcc[GetPosLit(j)] + aNumLitOcc[GetNegLit(j)];
+      if (iClauseVisits >= (iNumLits >> 2)) {
+        return;
+      }
+    }
+  }
+
+  /* return to the old assignment, then flip each variable that changed */
+
+  for (j=0;j<iNumDiff;j++) {
+    aVarValue[aIncRestartDiff[j]] = aIncRestartPrev[aIncRestartDiff[j]];
+  }
+
+  iSaveFlipCandidate = iFlipCandidate;
+
+  for (j=0;j<iNumDiff;j++) {
+    iFlipCandidate = aIncRestartDiff[j];
+
+    RunProcedures2(FlipCandidate);
+
+    /* only the updates of the state information skipped below are run,
+       so that the statistics do not count these flips */
+
+    for (k=0;k<aNumActiveProcedures[UpdateStateInfo];k++) {
+      pProc = aActiveProcedures[UpdateStateInfo][k];
+      if ((pProc == UpdateVarScore) || (pProc == UpdateVarScoreW) ||
+          (pProc == UpdateMakeBreak) || (pProc == UpdateMakeBreakW) || (pProc == UpdateVarInFalse) ||
+          (pProc == UpdateImproveCount)) {
+        pProc();
+      }
+    }
+  }
+
+  iFlipCandidate = iSaveFlipCandidate;
+
+  bIncRestartReplayed = TRUE;
+}
+
+void DoneIncRestart() {
+  bIncRestartReplayed = FALSE;
+  bIncRestartValid = TRUE;
+}
+
+/* a flip of iFlipCandidate that is not a search step (i.e.: the IRoTS
+   restore): the flip procedures run, but of the UpdateStateInfo procedures
+   only those that maintain the state information (scores, make / break,
+   false clause & VarInFalse lists, improve & sideways counts, and the
+   per-clause satisfied status of UnsatCounts & ClauseLast), so that the
+   run statistics (flipcount, localmins, nullflips, fdc, ...) do not count it */
+
+void ReplayFlipStateInfo() {
+  UINT32 k;
+  FXNPTR pProc;
+
+  RunProcedures2(FlipCandidate);
+
+  for (k=0;k<aNumActiveProcedures[UpdateStateInfo];k++) {
+    pProc = aActiveProcedures[UpdateStateInfo][k];
+    if ((pProc == UpdateVarScore) || (pProc == UpdateVarScoreW) ||
+        (pProc == UpdateMakeBreak) || (pProc == UpdateMakeBreakW) || (pProc == UpdateVarInFalse) ||
+        (pProc == UpdateFalseClauseList) || (pProc == UpdateImproveCount) ||
+        (pProc == UpdateTrackChanges) || (pProc == UpdateTrackChangesW) ||
+        (pProc == UpdateSidewaysChanges) || (pProc == UpdateSidewaysChangesW) ||
+        (pProc == UpdateUnsatCounts) || (pProc == UpdateClauseLast)) {
+      pProc();
+    }
+  }
+}
+
+void CreateFlipCounts() {
+  aFlipCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+}
+
+void InitFlipCounts() {
+  if (iStep == 1) {
+    memset(aFlipCounts,0,(iNumVars+1)*sizeof(UINT32));
+  }
+}
+
+void UpdateFlipCounts() {
+  aFlipCounts[iFlipCandidate]++;
+}
+
+void FlipCountStats() {
+  UINT32 j;
+  FLOAT fSum = FLOATZERO;
+  FLOAT fSum2 = FLOATZERO;
+  
+  for (j=1;j<(iNumVars+1);j++) {
+    fSum += (FLOAT) aFlipCounts[j];
+    fSum2 += (FLOAT) (aFlipCounts[j] * aFlipCounts[j]);
+  }
+
+  CalculateStats(&fFlipCountsMean,&fFlipCountsStdDev,&fFlipCountsCV,fSum,fSum2,iNumVars);
+}
+
+void CreateBiasCounts() {
+  aBiasTrueCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+  aBiasFalseCounts = AllocateRAM((iNumVars+1)*sizeof(UINT32));
+}
+
+void PreInitBiasCounts() {
+  UINT32 j;
+  if (iStep == 1) {
+    memset(aBiasTrueCounts,0,(iNumVars+1)*sizeof(UINT32));
+    memset(aBiasFalseCounts,0,(iNumVars+1)*sizeof(UINT32));
+  } else {
+    for (j=1;j<=iNumVars;j++) {
+      if (aVarValue[j]) {
+        aBiasTrueCounts[j] += (iStep-1-(aVarLastChange[j]));
+      } else {
+        aBiasFalseCounts[j] += (iStep-1-(aVarLastChange[j]));
+      }
+    }
+  }
+}
+
+void UpdateBiasCounts() {
+  if (iFlipCandidate) {
+    if (aVarValue[iFlipCandidate]) {
+      aBiasTrueCounts[iFlipCandidate] += (iStep-(aVarLastChange[iFlipCandidate]));
+    } else {
+      aBiasFalseCounts[iFlipCandidate] += (iStep-(aVarLastChange[iFlipCandidate]));
+    }
+  }
+}
+
+void FinalBiasCounts() {
+  UINT32 j;
+  for (j=1;j<=iNumVars;j++) {
+    if (aVarValue[j]) {
+      aBiasTrueCounts[j] += (iStep-(aVarLastChange[j]));
+    } else {
+      aBiasFalseCounts[j] += (iStep-(aVarLastChange[j]));
+    }
   }
 }
 
@@ -4286,6 +6191,7 @@ void BiasStats() {
 
 void CreateUnsatCounts() {
   aUnsatCounts = AllocateRAM(iNumClauses*sizeof(UINT32));
+  aUnsatCountsSince = AllocateRAM(iNumClauses*sizeof(UINT32));
 }
 
 void InitUnsatCounts() {
@@ -4294,11 +6200,61 @@ void InitUnsatCounts() {
   }
 }
 
+/* only the clauses that change (un)satisfied are visited: a clause that
+   becomes unsatisfied records the step, and the steps are added to
+   aUnsatCounts[] when it becomes satisfied (or the run ends) */
+
+void SyncUnsatCountsClause(UINT32 iClause) {
+  if (aNumTrueLit[iClause]==0) {
+    if (aUnsatCountsSince[iClause]==0) {
+      aUnsatCountsSince[iClause] = iStep;
+    }
+  } else {
+    if (aUnsatCountsSince[iClause]) {
+      aUnsatCounts[iClause] += iStep - aUnsatCountsSince[iClause];
+      aUnsatCountsSince[iClause] = 0;
+    }
+  }
+}
+
+void SyncUnsatCounts() {
+  UINT32 j;
+  if (iStep == 1) {
+    memset(aUnsatCountsSince,0,iNumClauses*sizeof(UINT32));
+  }
+  for (j=0;j<iNumClauses;j++) {
+    SyncUnsatCountsClause(j);
+  }
+}
+
 void UpdateUnsatCounts() {
+  UINT32 j;
+  UINT32 *pClause;
+  LITTYPE litCur;
+
+  if (iFlipCandidate == 0) {
+    return;
+  }
+
+  litCur = GetFalseLit(iFlipCandidate);
+  pClause = pLitClause[litCur];
+  for (j=0;j<aNumLitOcc[litCur];j++) {
+    SyncUnsatCountsClause(*pClause++);
+  }
+
+  litCur = GetTrueLit(iFlipCandidate);
+  pClause = pLitClause[litCur];
+  for (j=0;j<aNumLitOcc[litCur];j++) {
+    SyncUnsatCountsClause(*pClause++);
+  }
+}
+
+void FinalUnsatCounts() {
   UINT32 j;
   for (j=0;j<iNumClauses;j++) {
-    if (aNumTrueLit[j]==0) {
-      aUnsatCounts[j]++;
+    if (aUnsatCountsSince[j]) {
+      aUnsatCounts[j] += iStep - aUnsatCountsSince[j] + 1;
+      aUnsatCountsSince[j] = 0;
     }
   }
 }
@@ -4333,13 +6289,15 @@ void InitNumFalseCounts() {
 }
 
 void UpdateNumFalseCounts() {
+  UINT32 iStatStep = StatStep();
+
   aNumFalseCounts[iNumFalse]++;
 
   if (iReportFalseHistCount) {
-    if (iStep > iReportFalseHistCount) {
-      aNumFalseCounts[aNumFalseCountsWindow[iStep % iReportFalseHistCount]]--;
+    if (iStatStep > iReportFalseHistCount) {
+      aNumFalseCounts[aNumFalseCountsWindow[iStatStep % iReportFalseHistCount]]--;
     }
-    aNumFalseCountsWindow[iStep % iReportFalseHistCount] = iNumFalse;
+    aNumFalseCountsWindow[iStatStep % iReportFalseHistCount] = iNumFalse;
   }
 }
 
@@ -4360,32 +6318,80 @@ void InitDistanceCounts() {
 }
 
 void UpdateDistanceCounts() {
+  UINT32 iStatStep = StatStep();
 
   aDistanceCounts[iSolutionDistance]++;
 
   if (iReportDistHistCount) {
-    if (iStep > iReportDistHistCount) {
-      aDistanceCounts[aDistanceCountsWindow[iStep % iReportDistHistCount]]--;
+    if (iStatStep > iReportDistHistCount) {
+      aDistanceCounts[aDistanceCountsWindow[iStatStep % iReportDistHistCount]]--;
     }
-    aDistanceCountsWindow[iStep % iReportDistHistCount] = iSolutionDistance;
+    aDistanceCountsWindow[iStatStep % iReportDistHistCount] = iSolutionDistance;
   }
 }
 
 void CreateClauseLast() {
   aClauseLast = AllocateRAM(iNumClauses*sizeof(UINT32));
+  aClauseLastSince = AllocateRAM(iNumClauses*sizeof(UINT32));
+}
+
+/* (as with UnsatCounts, aClauseLast[] is only set when a clause becomes
+    satisfied, unless it was unsatisfied for none of the steps) */
+
+void SyncClauseLastClause(UINT32 iClause) {
+  if (aNumTrueLit[iClause]==0) {
+    if (aClauseLastSince[iClause]==0) {
+      aClauseLastSince[iClause] = iStep;
+    }
+  } else {
+    if (aClauseLastSince[iClause]) {
+      if (aClauseLastSince[iClause] < iStep) {
+        aClauseLast[iClause] = iStep - 1;
+      }
+      aClauseLastSince[iClause] = 0;
+    }
+  }
 }
 
 void InitClauseLast() {
+  UINT32 j;
   if (iStep == 1) {
     memset(aClauseLast,0,iNumClauses*sizeof(UINT32));
+    memset(aClauseLastSince,0,iNumClauses*sizeof(UINT32));
+  }
+  for (j=0;j<iNumClauses;j++) {
+    SyncClauseLastClause(j);
   }
 }
 
 void UpdateClauseLast() {
+  UINT32 j;
+  UINT32 *pClause;
+  LITTYPE litCur;
+
+  if (iFlipCandidate == 0) {
+    return;
+  }
+
+  litCur = GetFalseLit(iFlipCandidate);
+  pClause = pLitClause[litCur];
+  for (j=0;j<aNumLitOcc[litCur];j++) {
+    SyncClauseLastClause(*pClause++);
+  }
+
+  litCur = GetTrueLit(iFlipCandidate);
+  pClause = pLitClause[litCur];
+  for (j=0;j<aNumLitOcc[litCur];j++) {
+    SyncClauseLastClause(*pClause++);
+  }
+}
+
+void FinalClauseLast() {
   UINT32 j;
   for (j=0;j<iNumClauses;j++) {
-    if (aNumTrueLit[j]==0) {
+    if (aClauseLastSince[j]) {
       aClauseLast[j] = iStep;
+      aClauseLastSince[j] = 0;
     }
   }
 }
@@ -4444,6 +6450,13 @@ void CreatePenaltyStats() {
   aPenaltyStatsCVSum = AllocateRAM(iNumClauses*sizeof(FLOAT));
   aPenaltyStatsCVSum2 = AllocateRAM(iNumClauses*sizeof(FLOAT));
 
+  aPenaltyStatsLast = AllocateRAM(iNumClauses*sizeof(FLOAT));
+  aPenaltyStatsNormAt = AllocateRAM(iNumClauses*sizeof(FLOAT));
+  aPenaltyStatsNorm2At = AllocateRAM(iNumClauses*sizeof(FLOAT));
+  memset(aPenaltyStatsLast,0,iNumClauses*sizeof(FLOAT));
+
+  bPenaltyStats = TRUE;
+
   memset(aPenaltyStatsMeanSum,0,iNumClauses*sizeof(FLOAT));
   memset(aPenaltyStatsMeanSum2,0,iNumClauses*sizeof(FLOAT));
   memset(aPenaltyStatsStddevSum,0,iNumClauses*sizeof(FLOAT));
@@ -4456,45 +6469,74 @@ void CreatePenaltyStats() {
 void InitPenaltyStats() {
   memset(aPenaltyStatsSum,0,iNumClauses*sizeof(FLOAT));
   memset(aPenaltyStatsSum2,0,iNumClauses*sizeof(FLOAT));
+  memset(aPenaltyStatsNormAt,0,iNumClauses*sizeof(FLOAT));
+  memset(aPenaltyStatsNorm2At,0,iNumClauses*sizeof(FLOAT));
+  fPenaltyStatsNorm = FLOATZERO;
+  fPenaltyStatsNorm2 = FLOATZERO;
+  UpdatePenaltyStatsAll();
 }
 
-void UpdatePenaltyStatsStep() {
-  UINT32 j;
-  FLOAT fCurPen;
+void UpdatePenaltyStatsClause(UINT32 iClause) {
+  FLOAT fLast;
+
+  fLast = aPenaltyStatsLast[iClause];
+
+  aPenaltyStatsSum[iClause] += fLast * (fPenaltyStatsNorm - aPenaltyStatsNormAt[iClause]);
+  aPenaltyStatsSum2[iClause] += fLast * fLast * (fPenaltyStatsNorm2 - aPenaltyStatsNorm2At[iClause]);
+
+  aPenaltyStatsNormAt[iClause] = fPenaltyStatsNorm;
+  aPenaltyStatsNorm2At[iClause] = fPenaltyStatsNorm2;
+
+  if (bClausePenaltyFLOAT) {
+    aPenaltyStatsLast[iClause] = aClausePenaltyFL[iClause];
+  } else {
+    aPenaltyStatsLast[iClause] = (FLOAT) aClausePenaltyINT[iClause];
+  }
+}
 
+void UpdatePenaltyStatsAll() {
+  UINT32 j;
   for (j=0;j<iNumClauses;j++) {
-    if (bClausePenaltyFLOAT) {
-      if (bReportPenaltyReNormFraction) {
-        fCurPen = aClausePenaltyFL[j] / fTotalPenaltyFL;
+    UpdatePenaltyStatsClause(j);
+  }
+}
+
+void UpdatePenaltyStatsStep() {
+  FLOAT fNorm;
+
+  if (bClausePenaltyFLOAT) {
+    if (bReportPenaltyReNormFraction) {
+      fNorm = 1.0f / fTotalPenaltyFL;
+    } else {
+      if (bReportPenaltyReNormBase) {
+        fNorm = 1.0f / fBasePenaltyFL;
       } else {
-        if (bReportPenaltyReNormBase) {
-          fCurPen = aClausePenaltyFL[j] / fBasePenaltyFL;
-        } else {
-          fCurPen = aClausePenaltyFL[j];
-        }
+        fNorm = 1.0f;
       }
+    }
+  } else {
+    if (bReportPenaltyReNormFraction) {
+      fNorm = 1.0f / ((FLOAT) iTotalPenaltyINT);
     } else {
-      if (bReportPenaltyReNormFraction) {
-        fCurPen = ((FLOAT) aClausePenaltyINT[j]) / ((FLOAT) iTotalPenaltyINT);
+      if (bReportPenaltyReNormBase) {
+        fNorm = 1.0f / ((FLOAT) iBasePenaltyINT);
       } else {
-        if (bReportPenaltyReNormBase) {
-          fCurPen = ((FLOAT) aClausePenaltyINT[j]) / ((FLOAT) iBasePenaltyINT);
-        } else {
-          fCurPen = (FLOAT) aClausePenaltyINT[j];
-        }
+        fNorm = 1.0f;
       }
     }
-
-    aPenaltyStatsSum[j] += fCurPen;
-    aPenaltyStatsSum2[j] += (fCurPen * fCurPen);
-
-    CalculateStats(&aPenaltyStatsMean[j],&aPenaltyStatsStddev[j],&aPenaltyStatsCV[j],aPenaltyStatsSum[j],aPenaltyStatsSum2[j],iStep);
   }
+
+  fPenaltyStatsNorm += fNorm;
+  fPenaltyStatsNorm2 += fNorm * fNorm;
 }
 
 void UpdatePenaltyStatsRun() {
   UINT32 j;
+
+  UpdatePenaltyStatsAll();
+
   for (j=0;j<iNumClauses;j++) {
+    CalculateStats(&aPenaltyStatsMean[j],&aPenaltyStatsStddev[j],&aPenaltyStatsCV[j],aPenaltyStatsSum[j],aPenaltyStatsSum2[j],iStep);
     aPenaltyStatsMeanSum[j] += aPenaltyStatsMean[j];
     aPenaltyStatsMeanSum2[j] += (aPenaltyStatsMean[j] * aPenaltyStatsMean[j]);
     aPenaltyStatsStddevSum[j] += aPenaltyStatsStddev[j];
@@ -4549,16 +6591,22 @@ void CreateMobilityWindow() {
   if (iVarFlipHistoryLen == 0) {
     ReportPrint(pRepErr,"Unexpected Error: Variable Flip History Length = 0\n");
   }
+  if (iMobilitySample == 0) {
+    iMobilitySample = 1;
+  }
   aMobilityWindowVarChange = AllocateRAM((iNumVars+1) * sizeof(UINT32));
   aMobilityWindow = AllocateRAM((iVarFlipHistoryLen+1) * sizeof(UINT32));
   aMobilityWindowSum = AllocateRAM((iVarFlipHistoryLen+1) * sizeof(FLOAT));
   aMobilityWindowSum2 = AllocateRAM((iVarFlipHistoryLen+1) * sizeof(FLOAT));
+  aMobilityWindowCount = AllocateRAM((iVarFlipHistoryLen+1) * sizeof(UINT32));
 }
 
 void InitMobilityWindow() {
+  memset(aMobilityWindowVarChange,0,(iNumVars+1) * sizeof(UINT32));
   memset(aMobilityWindow,0,(iVarFlipHistoryLen+1) * sizeof(UINT32));
   memset(aMobilityWindowSum,0,(iVarFlipHistoryLen+1) * sizeof(FLOAT));
   memset(aMobilityWindowSum2,0,(iVarFlipHistoryLen+1) * sizeof(FLOAT));
+  memset(aMobilityWindowCount,0,(iVarFlipHistoryLen+1) * sizeof(UINT32));
 }
 
 void UpdateMobilityWindow() {
@@ -4572,7 +6620,9 @@ void UpdateMobilityWindow() {
     return;
   }
 
-  memset(aMobilityWindowVarChange,0,(iNumVars+1) * sizeof(UINT32));
+  if (iStep % iMobilitySample) {
+    return;
+  }
 
   if (iStep < iVarFlipHistoryLen) {
     iStopWindow = iStep;
@@ -4602,12 +6652,93 @@ void UpdateMobilityWindow() {
 
     aMobilityWindowSum[iWindowLen] += (FLOAT) aMobilityWindow[iWindowLen];
     aMobilityWindowSum2[iWindowLen] += (FLOAT) (aMobilityWindow[iWindowLen] * aMobilityWindow[iWindowLen]);
+    aMobilityWindowCount[iWindowLen]++;
 
     iCurPos--;
     if (iCurPos == -1) {
       iCurPos = iVarFlipHistoryLen - 1;
     }
   }
+
+  /* clear only the variables in the window (instead of all variables) */
+
+  iCurPos = (iStep % iVarFlipHistoryLen);
+
+  for (iWindowLen = 1; iWindowLen < iStopWindow; iWindowLen++) {
+    aMobilityWindowVarChange[aVarFlipHistory[iCurPos]] = 0;
+    iCurPos--;
+    if (iCurPos == -1) {
+      iCurPos = iVarFlipHistoryLen - 1;
+    }
+  }
+}
+
+
+void CreateMobilityFixed() {
+  aMobilityFixedParity = NULL;
+  aMobilityNParity = NULL;
+  if ((pRepMobFixed->bActive)||(pRepMobFixedFreq->bActive)||(bMobilityColXActive)) {
+    aMobilityFixedParity = AllocateRAM((iNumVars+1) * sizeof(BYTE));
+  }
+  if (bMobilityColNActive) {
+    aMobilityNParity = AllocateRAM((iNumVars+1) * sizeof(BYTE));
+  }
+}
+
+void InitMobilityFixed() {
+  if (aMobilityFixedParity) {
+    memset(aMobilityFixedParity,0,(iNumVars+1) * sizeof(BYTE));
+  }
+  if (aMobilityNParity) {
+    memset(aMobilityNParity,0,(iNumVars+1) * sizeof(BYTE));
+  }
+  iMobilityFixed = 0;
+  fMobilityFixedSum = FLOATZERO;
+  fMobilityFixedSum2 = FLOATZERO;
+  iMobilityN = 0;
+  fMobilityNSum = FLOATZERO;
+  fMobilityNSum2 = FLOATZERO;
+}
+
+void ToggleMobilityFixed(BYTE *aParity, UINT32 *pDistance, UINT32 iVar) {
+  if (iVar) {
+    aParity[iVar] = 1 - aParity[iVar];
+    if (aParity[iVar]) {
+      (*pDistance)++;
+    } else {
+      (*pDistance)--;
+    }
+  }
+}
+
+void SlideMobilityFixed(BYTE *aParity, UINT32 iWindowLen, UINT32 *pDistance, FLOAT *pSum, FLOAT *pSum2) {
+
+  /* (as with MobilityWindow, the flip of step 1 is never in a window) */
+
+  ToggleMobilityFixed(aParity,pDistance,aVarFlipHistory[iStep % iVarFlipHistoryLen]);
+
+  if (iStep >= iWindowLen + 2) {
+    ToggleMobilityFixed(aParity,pDistance,aVarFlipHistory[(iStep - iWindowLen) % iVarFlipHistoryLen]);
+  }
+
+  if (iStep > iWindowLen) {
+    *pSum += (FLOAT) *pDistance;
+    *pSum2 += (FLOAT) (*pDistance * *pDistance);
+  }
+}
+
+void UpdateMobilityFixed() {
+
+  if (iStep == 1) {
+    return;
+  }
+
+  if (aMobilityFixedParity) {
+    SlideMobilityFixed(aMobilityFixedParity,iMobFixedWindow,&iMobilityFixed,&fMobilityFixedSum,&fMobilityFixedSum2);
+  }
+  if (aMobilityNParity) {
+    SlideMobilityFixed(aMobilityNParity,iNumVars,&iMobilityN,&fMobilityNSum,&fMobilityNSum2);
+  }
 }
 
 
@@ -4626,16 +6757,18 @@ void InitMobilityFixedFrequencies() {
 void UpdateMobilityFixedFrequencies() {
   if (iStep <= iMobFixedWindow) {
     if (bMobilityFixedIncludeStart) {
-      aMobilityFixedFrequencies[aMobilityWindow[iStep-1]]++;
+      aMobilityFixedFrequencies[iMobilityFixed]++;
     }
   } else {
-    aMobilityFixedFrequencies[aMobilityWindow[iMobFixedWindow]]++;
+    aMobilityFixedFrequencies[iMobilityFixed]++;
   }
 }
 
 
 void CreateAutoCorr() {
 
+  UINT32 j;
+
   if (iAutoCorrMaxLen == 0) {
     iAutoCorrMaxLen = iNumVars;
   }
@@ -4643,12 +6776,132 @@ void CreateAutoCorr() {
   aAutoCorrStartBuffer = AllocateRAM((iAutoCorrMaxLen) * sizeof(FLOAT));
   aAutoCorrEndCircBuffer = AllocateRAM((iAutoCorrMaxLen) * sizeof(FLOAT));
   aAutoCorrCrossSum = AllocateRAM((iAutoCorrMaxLen) * sizeof(FLOAT));
+
+  /* for long windows, the cross sums are calculated a block at a time with an FFT */
+
+  bAutoCorrFFT = (iAutoCorrMaxLen >= AUTOCORRFFTMINLEN);
+
+  if (bAutoCorrFFT) {
+    iAutoCorrBlockLen = 1;
+    while (iAutoCorrBlockLen < iAutoCorrMaxLen) {
+      iAutoCorrBlockLen *= 2;
+    }
+    aAutoCorrBlock = AllocateRAM((iAutoCorrBlockLen * 2) * sizeof(FLOAT));
+    aAutoCorrFFTRe = AllocateRAM((iAutoCorrBlockLen * 2) * sizeof(FLOAT));
+    aAutoCorrFFTIm = AllocateRAM((iAutoCorrBlockLen * 2) * sizeof(FLOAT));
+    aAutoCorrFFTCos = AllocateRAM(iAutoCorrBlockLen * sizeof(FLOAT));
+    aAutoCorrFFTSin = AllocateRAM(iAutoCorrBlockLen * sizeof(FLOAT));
+    for (j=0;j<iAutoCorrBlockLen;j++) {
+      aAutoCorrFFTCos[j] = cos(FLOATPI * (FLOAT) j / (FLOAT) iAutoCorrBlockLen);
+      aAutoCorrFFTSin[j] = -sin(FLOATPI * (FLOAT) j / (FLOAT) iAutoCorrBlockLen);
+    }
+  }
 }
 
 void InitAutoCorr() {
   fAutoCorrSum = FLOATZERO;
   fAutoCorrSum2 = FLOATZERO;
   memset(aAutoCorrCrossSum,0,iAutoCorrMaxLen*sizeof(FLOAT));
+  if (bAutoCorrFFT) {
+    memset(aAutoCorrBlock,0,(iAutoCorrBlockLen * 2) * sizeof(FLOAT));
+    iAutoCorrBlockFill = 0;
+  }
+}
+
+void AutoCorrFFT() {
+
+  /* in-place radix-2 FFT of aAutoCorrFFTRe + i aAutoCorrFFTIm (length 2 * iAutoCorrBlockLen) */
+
+  UINT32 iLen = iAutoCorrBlockLen * 2;
+  UINT32 iHalf;
+  UINT32 iTwiddleStep;
+  UINT32 i,j,k;
+  FLOAT fTemp;
+  FLOAT fRe;
+  FLOAT fIm;
+
+  j = 0;
+  for (i=0;i<iLen-1;i++) {
+    if (i < j) {
+      fTemp = aAutoCorrFFTRe[i]; aAutoCorrFFTRe[i] = aAutoCorrFFTRe[j]; aAutoCorrFFTRe[j] = fTemp;
+      fTemp = aAutoCorrFFTIm[i]; aAutoCorrFFTIm[i] = aAutoCorrFFTIm[j]; aAutoCorrFFTIm[j] = fTemp;
+    }
+    k = iLen >> 1;
+    while (k <= j) {
+      j -= k;
+      k >>= 1;
+    }
+    j += k;
+  }
+
+  for (iHalf=1;iHalf<iLen;iHalf*=2) {
+    iTwiddleStep = iAutoCorrBlockLen / iHalf;
+    for (i=0;i<iLen;i+=iHalf*2) {
+      for (j=0;j<iHalf;j++) {
+        k = i + j + iHalf;
+        fRe = aAutoCorrFFTRe[k] * aAutoCorrFFTCos[j * iTwiddleStep] - aAutoCorrFFTIm[k] * aAutoCorrFFTSin[j * iTwiddleStep];
+        fIm = aAutoCorrFFTRe[k] * aAutoCorrFFTSin[j * iTwiddleStep] + aAutoCorrFFTIm[k] * aAutoCorrFFTCos[j * iTwiddleStep];
+        aAutoCorrFFTRe[k] = aAutoCorrFFTRe[i+j] - fRe;
+        aAutoCorrFFTIm[k] = aAutoCorrFFTIm[i+j] - fIm;
+        aAutoCorrFFTRe[i+j] += fRe;
+        aAutoCorrFFTIm[i+j] += fIm;
+      }
+    }
+  }
+}
+
+void AutoCorrFFTBlock() {
+
+  /* adds the cross sums of the current block (aAutoCorrBlock[B..2B-1]) with the
+     values up to iAutoCorrMaxLen steps before it (the previous block is in aAutoCorrBlock[0..B-1])
+
+     y = previous + current block, z = current block only
+     the cross sum for lag k is the (circular) correlation of y and z:  IFFT(conj(Y) Z)[k]
+     y and z are both real, so they are transformed together as y + iz */
+
+  UINT32 iLen = iAutoCorrBlockLen * 2;
+  UINT32 j,k;
+  FLOAT fYRe, fYIm, fZRe, fZIm;
+  FLOAT fPRe, fPIm;
+  FLOAT fValue;
+
+  for (j=0;j<iLen;j++) {
+    aAutoCorrFFTRe[j] = aAutoCorrBlock[j];
+    if (j < iAutoCorrBlockLen) {
+      aAutoCorrFFTIm[j] = FLOATZERO;
+    } else {
+      aAutoCorrFFTIm[j] = aAutoCorrBlock[j];
+    }
+  }
+
+  AutoCorrFFT();
+
+  for (j=0;j<=iAutoCorrBlockLen;j++) {
+    k = (iLen - j) % iLen;
+    fYRe = 0.5f * (aAutoCorrFFTRe[j] + aAutoCorrFFTRe[k]);
+    fYIm = 0.5f * (aAutoCorrFFTIm[j] - aAutoCorrFFTIm[k]);
+    fZRe = 0.5f * (aAutoCorrFFTIm[j] + aAutoCorrFFTIm[k]);
+    fZIm = 0.5f * (aAutoCorrFFTRe[k] - aAutoCorrFFTRe[j]);
+    fPRe = fYRe * fZRe + fYIm * fZIm;
+    fPIm = fYRe * fZIm - fYIm * fZRe;
+
+    /* conjugated for the inverse transform (the product is hermitian) */
+
+    aAutoCorrFFTRe[j] = fPRe;
+    aAutoCorrFFTIm[j] = -fPIm;
+    aAutoCorrFFTRe[k] = fPRe;
+    aAutoCorrFFTIm[k] = fPIm;
+  }
+
+  AutoCorrFFT();
+
+  for (k=0;k<iAutoCorrMaxLen;k++) {
+    fValue = aAutoCorrFFTRe[k+1] / (FLOAT) iLen;
+    if (!bWeighted) {
+      fValue = floor(fValue + 0.5f);
+    }
+    aAutoCorrCrossSum[k] += fValue;
+  }
 }
 
 void UpdateAutoCorr() {
@@ -4673,8 +6926,17 @@ void UpdateAutoCorr() {
   fAutoCorrSum += fCurValue;
   fAutoCorrSum2 += (fCurValue * fCurValue);
 
-  for (k=0; k<iLoopIndex; k++) {
-    aAutoCorrCrossSum[k] += (fCurValue * aAutoCorrEndCircBuffer[(iStep - k - 1) % iAutoCorrMaxLen]);
+  if (bAutoCorrFFT) {
+    aAutoCorrBlock[iAutoCorrBlockLen + iAutoCorrBlockFill++] = fCurValue;
+    if (iAutoCorrBlockFill == iAutoCorrBlockLen) {
+      AutoCorrFFTBlock();
+      memcpy(aAutoCorrBlock,&aAutoCorrBlock[iAutoCorrBlockLen],iAutoCorrBlockLen * sizeof(FLOAT));
+      iAutoCorrBlockFill = 0;
+    }
+  } else {
+    for (k=0; k<iLoopIndex; k++) {
+      aAutoCorrCrossSum[k] += (fCurValue * aAutoCorrEndCircBuffer[(iStep - k - 1) % iAutoCorrMaxLen]);
+    }
   }
 
   aAutoCorrEndCircBuffer[(iStep % iAutoCorrMaxLen)] = fCurValue;
@@ -4692,6 +6954,14 @@ void CalcAutoCorr() {
   FLOAT fSumEnd = fAutoCorrSum;
   FLOAT fSumEnd2 = fAutoCorrSum2;
 
+  if ((bAutoCorrFFT)&&(iAutoCorrBlockFill)) {
+    for (k=iAutoCorrBlockFill; k<iAutoCorrBlockLen; k++) {
+      aAutoCorrBlock[iAutoCorrBlockLen + k] = FLOATZERO;
+    }
+    AutoCorrFFTBlock();
+    iAutoCorrBlockFill = 0;
+  }
+
   if (iStep <= iAutoCorrMaxLen) {
     iLoopIndex = iStep-1;
     for (k=iStep; k<iAutoCorrMaxLen; k++) {
@@ -4786,25 +7056,175 @@ void CalcAutoCorrOne() {
 
 }
 
-void BranchFactor() {
+/* -statsample: the sampled triggers are moved out of the PostStep and
+   StepCalculations event lists, and the step loop only runs them on the
+   sample steps (every k steps, or with probability p), after the procedures
+   that are not sampled.  The last step of each run is always sampled.  The
+   sample steps are chosen with a separate generator, so the search itself is
+   unchanged.
+   (at PreStart, as the columns are activated at PostParameters) */
+
+void SetupStatSample() {
+
+  if ((fStatSample <= FLOATZERO) || ((fStatSample >= 1.0f) && (fStatSample != floor(fStatSample)))) {
+    ReportPrint(pRepErr,"Error: -statsample must be an integer interval (>= 1) or a probability (> 0 and < 1)\n");
+    AbnormalExit();
+  }
+
+  bStatSample = FALSE;
+  bStatSampleStep = FALSE;
+
+  if (fStatSample >= 1.0f) {
+    iStatSampleInterval = (UINT32) fStatSample;
+    if (iStatSampleInterval == 1) {
+      return;
+    }
+  } else {
+    iStatSampleInterval = 0;
+    fStatSampleLogQ = log(1.0f - fStatSample);
+  }
+
+  bStatSample = TRUE;
+  iStatSampleRand = (iSeed & 0xFFFFFFFF) | 1;
+
+  SplitSampledProcedures(PostStep);
+  SplitSampledProcedures(StepCalculations);
+}
+
+UINT32 NextStatSampleGap() {
+
+  /* geometric gap between samples (xorshift, independent of the search RNG) */
+
+  FLOAT fUniform;
+
+  if (iStatSampleInterval) {
+    return(iStatSampleInterval);
+  }
+
+  iStatSampleRand ^= (iStatSampleRand << 13) & 0xFFFFFFFF;
+  iStatSampleRand ^= iStatSampleRand >> 17;
+  iStatSampleRand ^= (iStatSampleRand << 5) & 0xFFFFFFFF;
+
+  fUniform = ((FLOAT) iStatSampleRand + 1.0f) / 4294967296.0f;
+
+  return(1 + (UINT32) floor(log(fUniform) / fStatSampleLogQ));
+}
+
+void InitStatSample() {
+  iStatSampleCount = 0;
+  bStatSampleStep = FALSE;
+  if (bStatSample) {
+    iStatSampleNext = NextStatSampleGap();
+  }
+}
+
+void UpdateStatSample() {
+  if ((bStatSample) && (iStep == iStatSampleNext)) {
+    bStatSampleStep = TRUE;
+    iStatSampleCount++;
+    iStatSampleNext += NextStatSampleGap();
+  } else {
+    bStatSampleStep = FALSE;
+  }
+}
+
+/* the # of sideways (zero score) variables is taken from the score changes
+   the algorithm already tracks (TrackChanges) or otherwise from ImproveCount,
+   so the branching factor does not scan the variables (or need VarScore) */
+
+void SelectSidewaysCount() {
+  bSidewaysChanges = IsTriggerActive("CreateTrackChanges");
+  if (bSidewaysChanges) {
+    ActivateTriggers("SidewaysChanges");
+  } else {
+    ActivateTriggers("ImproveCount");
+  }
+}
+
+void InitSidewaysChanges() {
   UINT32 j;
-  fBranchFactor = FLOATZERO;
+  iNumSideways = 0;
   for (j=1; j<=iNumVars; j++) {
     if (aVarScore[j] == 0) {
-      fBranchFactor += 1.0f;
+      iNumSideways++;
     }
   }
-  fBranchFactor /= (FLOAT) iNumVars;
 }
 
-void BranchFactorW() {
+void UpdateSidewaysChanges() {
+  UINT32 j;
+  UINT32 iVar;
+
+  if (iFlipCandidate == 0) {
+    return;
+  }
+
+  for (j=0; j<iNumChanges; j++) {
+    iVar = aChangeList[j];
+    if (aChangeOldScore[iVar] == 0) {
+      if (aVarScore[iVar] != 0) {
+        iNumSideways--;
+      }
+    } else if (aVarScore[iVar] == 0) {
+      iNumSideways++;
+    }
+  }
+}
+
+void SelectSidewaysCountW() {
+  bSidewaysChangesW = IsTriggerActive("CreateTrackChangesW");
+  if (bSidewaysChangesW) {
+    ActivateTriggers("SidewaysChangesW");
+  } else {
+    ActivateTriggers("ImproveCount");
+  }
+}
+
+void InitSidewaysChangesW() {
   UINT32 j;
-  fBranchFactorW = FLOATZERO;
+  iNumSidewaysW = 0;
   for (j=1; j<=iNumVars; j++) {
     if (aVarScoreW[j] == FLOATZERO) {
-      fBranchFactorW += 1.0f;
+      iNumSidewaysW++;
     }
   }
+}
+
+void UpdateSidewaysChangesW() {
+  UINT32 j;
+  UINT32 iVar;
+
+  if (iFlipCandidate == 0) {
+    return;
+  }
+
+  for (j=0; j<iNumChangesW; j++) {
+    iVar = aChangeListW[j];
+    if (aChangeOldScoreW[iVar] == FLOATZERO) {
+      if (aVarScoreW[iVar] != FLOATZERO) {
+        iNumSidewaysW--;
+      }
+    } else if (aVarScoreW[iVar] == FLOATZERO) {
+      iNumSidewaysW++;
+    }
+  }
+}
+
+void BranchFactor() {
+  if (bSidewaysChanges) {
+    fBranchFactor = (FLOAT) iNumSideways;
+  } else {
+    fBranchFactor = (FLOAT) iNumImproveZero;
+  }
+  fBranchFactor /= (FLOAT) iNumVars;
+}
+
+void BranchFactorW() {
+  if (bSidewaysChangesW) {
+    fBranchFactorW = (FLOAT) iNumSidewaysW;
+  } else {
+    fBranchFactorW = (FLOAT) iNumImproveZeroW;
+  }
   fBranchFactorW /= (FLOAT) iNumVars;
 }
 
@@ -4899,6 +7319,7 @@ void CreateSolutionDistance() {
 void UpdateSolutionDistance() {
   SetCurVarState(vsSolutionDistance);
   iSolutionDistance = MinHammingVarStateList(&vslKnownSoln,vsSolutionDistance);
+  iSolutionDistanceStep = iStep;
 }
 
 void InitFDCRun() {
@@ -4916,6 +7337,12 @@ void UpdateFDCRun() {
   FLOAT fDist;
   FLOAT fHeight;
 
+  /* (with -statsample, only the local minima with a current distance are used) */
+
+  if ((bStatSample) && (iSolutionDistanceStep + 1 != iStep)) {
+    return;
+  }
+
   if (IsLocalMinimum(bWeighted)) {
     
     fDist = (FLOAT) (iSolutionDistance);
@@ -4947,6 +7374,7 @@ void DynamicParms() {
 
 void FlushBuffers() {
   if (bReportFlush) {
+    RFFlush();
     fflush(NULL);
   }
 }
@@ -102,6 +102,19 @@ extern FLOAT fSumFalseW;
 /***** Trigger DefaultFlip[W] *****/
 
 
+/***** Trigger ParFlip *****/
+/*
+    iParFlipOcc           flip variables with at least this many occurrences on the thread pool
+    bParFlip              TRUE if parallel flips are enabled for this instance
+
+    parallel flips are supported by Flip+FalseClauseList, Flip+MakeBreak
+    and Flip+MBPFL+FCL+VIF
+*/
+
+extern UINT32 iParFlipOcc;
+extern BOOL bParFlip;
+
+
 /***** Trigger CheckTermination *****/
 
 
@@ -160,12 +173,35 @@ extern UINT32 *aVarInFalseList;
 extern UINT32 *aVarInFalseListPos;
 
 
+/***** Trigger ImproveCount *****/
+/*
+    aImproveScore[j]      score for variable[j] (as aVarScore), kept for any algorithm
+    aImproveScoreW[j]     (same as aImproveScore, but as a sum of clause weights)
+    aImproveCritSat[k]    critical variable for clause[k] if clause has only one true literal
+    iNumImproving         # variables with a negative (improving) score... 0 in a local minimum
+    iNumImprovingW        (same as iNumImproving, but for the weighted scores)
+    iNumImproveZero       # variables with a score of zero (sideways)
+    iNumImproveZeroW      (same as iNumImproveZero, but for the weighted scores)
+    bImproveCount         the counts are maintained (IsLocalMinimum() does not scan)
+*/
+
+extern SINT32 *aImproveScore;
+extern FLOAT *aImproveScoreW;
+extern UINT32 *aImproveCritSat;
+extern UINT32 iNumImproving;
+extern UINT32 iNumImprovingW;
+extern UINT32 iNumImproveZero;
+extern UINT32 iNumImproveZeroW;
+extern BOOL bImproveCount;
+
+
 /***** Trigger VarLastChange *****/
 /*
     aVarLastChange[j]     the step # of the most recent time variable[j] was flipped
     iVarLastChangeReset   the step # of the last time all aVarLastChange values were reset
 */
 
+void InitVarLastChange();
 void UpdateVarLastChange();
 extern UINT32 *aVarLastChange;
 extern UINT32 iVarLastChangeReset;
@@ -192,19 +228,61 @@ extern UINT32 *aChangeLastStepW;
 #define UpdateChange(var) {if(aChangeLastStep[var]!=iStep) {aChangeOldScore[var] = aVarScore[var]; aChangeLastStep[var]=iStep; aChangeList[iNumChanges++]=var;}}
 
 
-/***** Trigger DecPromVars *****/
+/***** Trigger DecPromVars[W] *****/
 /*
     iNumDecPromVars       # Decreasing Promising Variables
     aDecPromVarsList[j]   variable # of the jth decreasing promising Variable list
+    aDecPromVarsListPos[j]  the location of variable[j] in aDecPromVarsList
+    aDecPromVarsSeq[j]    the order variable[j] was (last) added to the list
+
+    (the weighted lists have the same layout, with a W suffix)
 */
 
 extern UINT32 *aDecPromVarsList;
+extern UINT32 *aDecPromVarsListPos;
+extern UINT32 *aDecPromVarsSeq;
+extern UINT32 iDecPromVarsSeq;
 extern UINT32 iNumDecPromVars;
 
 extern UINT32 *aDecPromVarsListW;
+extern UINT32 *aDecPromVarsListPosW;
+extern UINT32 *aDecPromVarsSeqW;
+extern UINT32 iDecPromVarsSeqW;
 extern UINT32 iNumDecPromVarsW;
 
 
+/***** Trigger DecPromBest[W] *****/
+/***** Trigger DecPromOldest *****/
+/*
+    hDecPromBest          the decreasing promising variables as a heap:
+                          best aVarScore first, then the oldest (aVarLastChange)
+    hDecPromOldest        the decreasing promising variables as a heap:
+                          the oldest (aVarLastChange) first
+    hDecPromBestW         the weighted decreasing promising variables as a heap:
+                          best aVarScoreW first, then the oldest (aVarLastChange)
+    aDecPromBestScore[j]  the score of variable[j] when it was last positioned in hDecPromBest
+    aDecPromBestScoreW[j] the score of variable[j] when it was last positioned in hDecPromBestW
+
+    remaining ties are broken by the order the variables were added
+    (aDecPromVarsSeq), so the top of each heap is the variable a scan of
+    aDecPromVarsList (in the order added) would select
+*/
+
+extern VARHEAP hDecPromBest;
+extern VARHEAP hDecPromOldest;
+extern VARHEAP hDecPromBestW;
+extern SINT32 *aDecPromBestScore;
+extern FLOAT *aDecPromBestScoreW;
+
+void CreateVarHeap(VARHEAP *pHeap);
+BOOL IsInVarHeap(VARHEAP *pHeap, UINT32 iVar);
+void InsertVarHeap(VARHEAP *pHeap, UINT32 iVar);
+void RemoveVarHeap(VARHEAP *pHeap, UINT32 iVar);
+void AdjustVarHeap(VARHEAP *pHeap, UINT32 iVar);
+BOOL IsDecPromVar(UINT32 iVar);
+BOOL IsDecPromVarW(UINT32 iVar);
+
+
 /***** Trigger BestScoreList *****/
 /*
     iNumBestScoreList       # of variables tied for the 'best' aVarScore
@@ -314,9 +392,15 @@ extern UINT32 iBestStepSumFalseW;
 /***** Trigger SaveBest *****/
 /*
     vsBest                the candidate solution for the best solution quality seen this run   
+
+    vsBest is updated lazily: the variables flipped since it was last
+    brought up to date are kept in a journal, and MaterializeSaveBest()
+    must be called before vsBest is read
 */
 extern VARSTATE vsBest;
 
+void MaterializeSaveBest();
+
 
 /***** Trigger StartFalse *****/
 /*
@@ -409,6 +493,37 @@ extern UINT32 iStartSeed;
 /***** Trigger CheckForRestarts *****/
 
 
+/***** Trigger RestartPolicy *****/
+/*
+    iRestartUnit          -restartbase for this instance (the # of variables if 0)
+    iRestartLength        # of flips until the next restart (0 = no more restarts this run)
+    iRestartLast          step of the last restart
+    iRestartNum           # of restarts this run (including the first initialization)
+    iRestartTry           # of flips between the last two restarts
+
+    each policy (RestartLuby, RestartGeometric, RestartAdaptive) sets
+    iRestartLength at PreInit, after StartRestartPolicy
+*/
+
+extern UINT32 iRestartUnit;
+extern UINT32 iRestartLength;
+extern UINT32 iRestartLast;
+extern UINT32 iRestartNum;
+extern UINT32 iRestartTry;
+
+
+/***** Trigger IncRestart *****/
+/*
+    bIncRestartReplayed   the state information was updated by flipping the variables that
+                          changed at this restart, so the Init procedures for state
+                          information maintained by flips are skipped
+*/
+
+extern BOOL bIncRestartReplayed;
+
+void ReplayFlipStateInfo();
+
+
 /***** Trigger FlipCounts *****/
 /*
     aFlipCounts[j]        # of times that variable[j] has been flipped this run
@@ -452,9 +567,14 @@ extern FLOAT fMeanMaxBias;
 /***** Trigger UnsatCounts *****/
 /*
     aUnsatCounts[j]       # of steps that clause[j] has been unsatisfied
+    aUnsatCountsSince[j]  step # that clause[j] became unsatisfied (0 if satisfied)
+
+    (the steps that a clause is unsatisfied are added when it becomes
+     satisfied, and at the end of the run for the clauses still unsatisfied)
 */
 
 extern UINT32 *aUnsatCounts;
+extern UINT32 *aUnsatCountsSince;
 
 
 /***** Trigger UnsatCountStats *****/
@@ -492,9 +612,11 @@ extern UINT32 *aDistanceCountsWindow;
 /***** Trigger ClauseLast *****/
 /*
     aClauseLast[j]        last step # for which clause[j] was unsatisfied
+    aClauseLastSince[j]   step # that clause[j] became unsatisfied (0 if satisfied)
 */
 
 extern UINT32 *aClauseLast;
+extern UINT32 *aClauseLastSince;
 
 
 /***** Trigger ClauseLast *****/
@@ -511,6 +633,16 @@ extern UINT32 *aSQGrid;
     aPenaltyStatsMean[j]    for current run, clause j, Clause Penalty Mean
     aPenaltyStatsStddev[j]  for current run, clause j, Clause Penalty Stddev
     aPenaltyStatsCV[j]      for current run, clause j, Clause Penalty CV
+
+    the (time weighted) sums of clause j are only brought up to date when its
+    penalty changes: the normalization factor (1/total or 1/base) is summed
+    once per step (fPenaltyStatsNorm, fPenaltyStatsNorm2), and the sums of
+    clause j grow by its last penalty times the factor summed since then
+
+    aPenaltyStatsLast[j]    penalty of clause j when its sums were last updated
+    aPenaltyStatsNormAt[j]  fPenaltyStatsNorm when its sums were last updated
+    aPenaltyStatsNorm2At[j] fPenaltyStatsNorm2 when its sums were last updated
+    bPenaltyStats           algorithms must call PenaltyStatsChange() when they change penalties
 */
 
 extern FLOAT *aPenaltyStatsMean;
@@ -527,6 +659,19 @@ extern FLOAT *aPenaltyStatsStddevSum2;
 extern FLOAT *aPenaltyStatsCVSum;
 extern FLOAT *aPenaltyStatsCVSum2;
 
+extern FLOAT *aPenaltyStatsLast;
+extern FLOAT *aPenaltyStatsNormAt;
+extern FLOAT *aPenaltyStatsNorm2At;
+extern FLOAT fPenaltyStatsNorm;
+extern FLOAT fPenaltyStatsNorm2;
+extern BOOL bPenaltyStats;
+
+void UpdatePenaltyStatsClause(UINT32 iClause);
+void UpdatePenaltyStatsAll();
+
+#define PenaltyStatsChange(c) {if (bPenaltyStats) {UpdatePenaltyStatsClause(c);}}
+#define PenaltyStatsChangeAll() {if (bPenaltyStats) {UpdatePenaltyStatsAll();}}
+
 
 /***** Trigger VarFlipHistory *****/
 /* 
@@ -544,16 +689,41 @@ extern UINT32 iVarFlipHistoryLen;
     aMobilityWindow[j]      Current hamming distance for mobility window length of j
     aMobilityWindowSum[j]   Cumulative sum of aMobilityWindow[j]
     aMobilityWindowSum2[j]  Cumulative sum of aMobilityWindow[j] ^2
+    aMobilityWindowCount[j] # of steps summed for window length j
+
+    (all window lengths are only calculated every iMobilitySample steps)
 */
 
 extern UINT32 *aMobilityWindow;
 extern FLOAT *aMobilityWindowSum;
 extern FLOAT *aMobilityWindowSum2;
+extern UINT32 *aMobilityWindowCount;
+
+
+/***** Trigger MobilityFixed *****/
+/*
+    iMobilityFixed          Current hamming distance for window length iMobFixedWindow
+    fMobilityFixedSum       Cumulative sum of iMobilityFixed (steps > iMobFixedWindow)
+    fMobilityFixedSum2      Cumulative sum of iMobilityFixed ^2
+    iMobilityN              Current hamming distance for window length n (# vars)
+    fMobilityNSum           Cumulative sum of iMobilityN (steps > n)
+    fMobilityNSum2          Cumulative sum of iMobilityN ^2
+
+    each window slides by one step: the variable flipped enters and the
+    variable flipped (window length) steps ago leaves
+*/
+
+extern UINT32 iMobilityFixed;
+extern FLOAT fMobilityFixedSum;
+extern FLOAT fMobilityFixedSum2;
+extern UINT32 iMobilityN;
+extern FLOAT fMobilityNSum;
+extern FLOAT fMobilityNSum2;
 
 
 /***** Trigger MobilityFixedFrequencies *****/
 /*
-    aMobilityFixedFrequencies[j]  # of times value j has occured for aMobilityWindow[iMobFixedWindow]
+    aMobilityFixedFrequencies[j]  # of times value j has occured for iMobilityFixed
 */
 
 extern UINT32 *aMobilityFixedFrequencies;
@@ -596,6 +766,38 @@ extern FLOAT fBranchFactor;
 extern FLOAT fBranchFactorW;
 
 
+/***** Trigger StatSample *****/
+/*
+    fStatSample         -statsample: >= 1 is an interval (k) of steps, < 1 a probability (p) of each step
+    bStatSample         the sampled triggers are only run on the sample steps (and the last step of a run)
+    bStatSampleStep     the current step is a sample step
+    iStatSampleCount    # of sample steps in the current run
+
+    StatStep()          the # of the current step, or with -statsample the # of the current sample
+*/
+
+extern FLOAT fStatSample;
+extern BOOL bStatSample;
+extern BOOL bStatSampleStep;
+extern UINT32 iStatSampleCount;
+
+#define StatStep() ((bStatSample) ? iStatSampleCount : iStep)
+
+
+/***** Trigger SidewaysCount[W] *****/
+/*
+    iNumSideways        # variables with aVarScore[j] == 0 (maintained from the TrackChanges list)
+    iNumSidewaysW       # variables with aVarScoreW[j] == 0 (from the TrackChangesW list)
+    bSidewaysChanges    iNumSideways is used (otherwise iNumImproveZero from ImproveCount)
+    bSidewaysChangesW   iNumSidewaysW is used (otherwise iNumImproveZeroW)
+*/
+
+extern UINT32 iNumSideways;
+extern UINT32 iNumSidewaysW;
+extern BOOL bSidewaysChanges;
+extern BOOL bSidewaysChangesW;
+
+
 
 /***** Trigger StepsUpDownSide *****/
 /*  
@@ -61,6 +61,7 @@
 #define FLOAT double
 #define FLOATMAX (1E+300)
 #define FLOATZERO (0.0f)
+#define FLOATPI (3.14159265358979323846)
 
 #define FLOATSTATSMIN (1E-8)
 
@@ -135,6 +136,13 @@ enum PARMTYPE {
    PTypeReport
 };
 
+enum REPORTFORMAT {
+  RFormatText,
+  RFormatJSON,
+  RFormatCSV,
+  RFormatBin
+};
+
 enum CDATATYPE {
   DTypeUInt,
   DTypeSInt,
@@ -175,6 +183,7 @@ typedef struct typeTRIGGER {
   
   BOOL bActive;
   BOOL bDisabled;
+  BOOL bSampled;
 
   char *sDependencyList;
   char *sDeactivateList;
@@ -240,11 +249,52 @@ typedef struct typeREPORT {
   void *aParameters[MAXREPORTPARMS];
 } REPORT;
 
+typedef struct typeQSKETCH {
+  UINT32 iNumLevels;
+  UINT32 iCount;
+  UINT32 iCompactions;
+  UINT32 aLevelSize[QSKETCHMAXLEVELS];
+  FLOAT *aLevel[QSKETCHMAXLEVELS];
+} QSKETCH;
+
+typedef struct typeVARHEAP {
+  UINT32 iNum;
+  UINT32 *aHeap;
+  UINT32 *aHeapPos;
+  BOOL (*fxnBefore)(UINT32 iVarA, UINT32 iVarB);
+} VARHEAP;
+
+typedef struct typeSTREAMSTAT {
+  UINT32 iCount;
+  FLOAT fMean;
+  FLOAT fM2;
+  FLOAT fMin;
+  FLOAT fMax;
+  FLOAT fStepSum;
+  FLOAT fStepProductSum;
+  QSKETCH qsAll;
+
+  BOOL bSolveFail;
+  UINT32 iCountSolve;
+  FLOAT fSumSolve;
+  FLOAT fSumFail;
+  FLOAT fMinSolve;
+  FLOAT fMaxSolve;
+  FLOAT fMinFail;
+  FLOAT fMaxFail;
+  QSKETCH qsSolve;
+  QSKETCH qsFail;
+} STREAMSTAT;
+
 typedef struct typeREPORTCOL {
   BOOL bActive;
 
   BOOL bAllocateColumnRAM;
 
+  BOOL bStreamColumn;
+  BOOL bStreamSolveFail;
+  STREAMSTAT *pStreamData;
+
   char *sDescription;
   char *sHeader1;
   char *sHeader2;
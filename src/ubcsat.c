@@ -26,6 +26,8 @@ const char sVersion[] = "1.1.0 (Sea to Sky Release)";
 
 int ubcsatmain(int argc, char *argv[]) {
   
+  StartWallClock();
+
   InitSeed();
 
   SetupUBCSAT();
@@ -47,82 +49,104 @@ int ubcsatmain(int argc, char *argv[]) {
 
   RunProcedures(PostParameters);
 
-  RunProcedures(ReadInInstance);
+  /* (with -instlist, once for each instance) */
+
+  while (NextInstance()) {
+
+    StartReadClock();
+    RunProcedures(ReadInInstance);
+    StopReadClock();
 
-  RunProcedures(PostRead);
+    RunProcedures(PostRead);
 
-  RunProcedures(CreateData);
-  RunProcedures(CreateStateInfo);
+    RunProcedures(CreateData);
+    RunProcedures(CreateStateInfo);
 
-  iRun = 0;
-  iNumSolutionsFound = 0;
-  bTerminateAllRuns = FALSE;
+    iRun = 0;
+    iNumSolutionsFound = 0;
+    bTerminateAllRuns = FALSE;
 
-  RunProcedures(PreStart);
+    RunProcedures(PreStart);
 
-  StartTotalClock();
+    StartTotalClock();
 
-  while ((iRun < iNumRuns) && (! bTerminateAllRuns)) {
+    while ((iRun < iNumRuns) && (! bTerminateAllRuns)) {
 
-    iRun++;
+      iRun++;
 
-    iStep = 0;
-    bSolutionFound = FALSE;
-    bTerminateRun = FALSE;
-    bRestart = TRUE;
+      iStep = 0;
+      bSolutionFound = FALSE;
+      bTerminateRun = FALSE;
+      bRestart = TRUE;
 
-    RunProcedures(PreRun);
+      RunProcedures(PreRun);
 
-    StartRunClock();
+      StartRunClock();
     
-    while ((iStep < iCutoff) && (! bSolutionFound) && (! bTerminateRun)) {
-
-      iStep++;
-      iFlipCandidate = 0;
-
-      RunProcedures(PreStep);
-      RunProcedures(CheckRestart);
-
-      if (bRestart) {
-        RunProcedures(PreInit);
-        RunProcedures(InitData);
-        RunProcedures(InitStateInfo);
-        RunProcedures(PostInit);
-        bRestart = FALSE;
-      } else {
-        RunProcedures(ChooseCandidate);
-        RunProcedures(PreFlip);
-        RunProcedures(FlipCandidate);
-        RunProcedures(UpdateStateInfo);
-        RunProcedures(PostFlip);
-      }
+      while ((iStep < iCutoff) && (! bSolutionFound) && (! bTerminateRun)) {
+
+        iStep++;
+        iFlipCandidate = 0;
+
+        RunProcedures(PreStep);
+        RunProcedures(CheckRestart);
+
+        if (bRestart) {
+          RunProcedures(PreInit);
+          RunProcedures(InitData);
+          RunProcedures(InitStateInfo);
+          RunProcedures(PostInit);
+          bRestart = FALSE;
+        } else {
+          RunProcedures(ChooseCandidate);
+          RunProcedures(PreFlip);
+          RunProcedures(FlipCandidate);
+          RunProcedures(UpdateStateInfo);
+          RunProcedures(PostFlip);
+        }
       
-      RunProcedures(PostStep);
+        RunProcedures(PostStep);
 
-      RunProcedures(StepCalculations);
+        if (bStatSampleStep) {
+          RunSampledProcedures(PostStep);
+        }
 
-      RunProcedures(CheckTerminate);
-    }
+        RunProcedures(StepCalculations);
+
+        if (bStatSampleStep) {
+          RunSampledProcedures(StepCalculations);
+        }
 
-    StopRunClock();
+        RunProcedures(CheckTerminate);
+      }
+
+      if ((bStatSample) && (! bStatSampleStep) && (iStep > 0)) {
+        bStatSampleStep = TRUE;
+        iStatSampleCount++;
+        RunSampledProcedures(PostStep);
+        RunSampledProcedures(StepCalculations);
+      }
 
-    RunProcedures(RunCalculations);
+      StopRunClock();
+
+      RunProcedures(RunCalculations);
     
-    RunProcedures(PostRun);
+      RunProcedures(PostRun);
 
-    if (bSolutionFound) {
-      iNumSolutionsFound++;
-      if (iNumSolutionsFound == iFind) {
-        bTerminateAllRuns = TRUE;
+      if (bSolutionFound) {
+        iNumSolutionsFound++;
+        if (iNumSolutionsFound == iFind) {
+          bTerminateAllRuns = TRUE;
+        }
       }
     }
-  }
 
-  StopTotalClock();
+    StopTotalClock();
 
-  RunProcedures(FinalCalculations);
+    RunProcedures(FinalCalculations);
 
-  RunProcedures(FinalReports);
+    RunProcedures(FinalReports);
+  }
 
   CleanExit();
 
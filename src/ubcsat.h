@@ -26,8 +26,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <math.h>
+#include <signal.h>
 
 #include "ubcsat-limits.h"
 #include "ubcsat-types.h"
@@ -35,10 +37,15 @@
 #include "ubcsat-lit.h"
 #include "ubcsat-mem.h"
 #include "ubcsat-time.h"
+#include "ubcsat-thread.h"
 #include "ubcsat-io.h"
 #include "ubcsat-internal.h"
 #include "ubcsat-globals.h"
 #include "ubcsat-triggers.h"
+#include "ubcsat-coop.h"
+#include "ubcsat-farm.h"
+#include "ubcsat-batch.h"
+#include "ubcsat-serve.h"
 
 #include "algorithms.h"
 #include "reports.h"